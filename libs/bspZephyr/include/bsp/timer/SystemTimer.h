@@ -59,6 +59,13 @@ uint64_t getSystemTimeMs(void);
  */
 uint64_t systemTicksToTimeUs(uint64_t ticks);
 
+/**
+ * Converts a value of getSystemTicks32Bit() to the time base of getSystemTimeUs32Bit().
+ * The ticks must not be older than one overrun period of the 32 bit tick counter.
+ * \return Systemtime in Us with overrun.
+ */
+uint32_t systemTicks32BitToTimeUs32Bit(uint32_t ticks);
+
 /**
  * Returns the converted value in Ns from a given value in system ticks.
  */
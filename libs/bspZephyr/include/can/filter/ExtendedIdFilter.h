@@ -0,0 +1,72 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <etl/array.h>
+#include <platform/estdint.h>
+
+namespace bios
+{
+/**
+ * Acceptance filter for 29 bit CAN IDs which is cheap enough to be evaluated in the RX
+ * interrupt.
+ *
+ * Exact IDs and ranges are kept in a table of disjoint ranges sorted by their first ID and
+ * looked up by a binary search without data dependent branches. IDs which are matched by a
+ * mask, e.g. a J1939 PGN from any source address, are compared against a short list of
+ * masks. A default constructed filter accepts no ID.
+ */
+class ExtendedIdFilter
+{
+public:
+    static size_t const MAX_RANGES = 32U;
+    static size_t const MAX_MASKS  = 8U;
+
+    ExtendedIdFilter();
+
+    /** \return false if the range table is full */
+    bool addId(uint32_t id) { return addRange(id, id); }
+
+    /**
+     * Accepts the IDs firstId..lastId, overlapping and adjacent ranges are merged.
+     * \return false if the range table is full or the range is invalid
+     */
+    bool addRange(uint32_t firstId, uint32_t lastId);
+
+    /**
+     * Accepts all IDs with (id & mask) == (value & mask).
+     * \return false if the mask list is full
+     */
+    bool addMask(uint32_t value, uint32_t mask);
+
+    /**
+     * Accepts the J1939 parameter group with any priority and source address and, for
+     * destination specific PGNs (PDU1 format), any destination address.
+     * \return false if the mask list is full
+     */
+    bool addPgn(uint32_t pgn);
+
+    /** accepts all IDs */
+    void open();
+
+    /** accepts no ID */
+    void clear();
+
+    bool isOpen() const { return _open; }
+
+    /**
+     * \param id 29 bit CAN ID without flags
+     */
+    bool match(uint32_t id) const;
+
+private:
+    ::etl::array<uint32_t, MAX_RANGES> _firstIds;
+    ::etl::array<uint32_t, MAX_RANGES> _lastIds;
+    ::etl::array<uint32_t, MAX_MASKS> _maskValues;
+    ::etl::array<uint32_t, MAX_MASKS> _masks;
+    size_t _rangeCount;
+    size_t _maskCount;
+    bool _open;
+};
+
+} // namespace bios
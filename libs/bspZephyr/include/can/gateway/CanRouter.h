@@ -0,0 +1,97 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <etl/array.h>
+#include <etl/span.h>
+#include <platform/estdint.h>
+#include <zephyr/drivers/can.h>
+
+namespace bios
+{
+class ZephyrCanTransceiver;
+
+/**
+ * Routing table for the frames received on one CAN bus.
+ *
+ * The router is called by the source transceiver from its RX interrupt and hands the driver's
+ * frame directly to the destination controller, without conversion to ::can::CANFrame and
+ * without a hop to the task context. Standard IDs are looked up in a direct table, extended
+ * IDs in an open addressing hash table. Routed frames are still delivered to the local
+ * listeners of the source transceiver.
+ */
+class CanRouter
+{
+public:
+    /** maximum number of routes, one route may cover a range of IDs */
+    static size_t const MAX_ROUTES = 32U;
+
+    /** number of extended IDs that can be routed is 2^EXTENDED_ID_BITS */
+    static uint32_t const EXTENDED_ID_BITS = 6U;
+    static size_t const EXTENDED_ID_SLOTS  = 1U << EXTENDED_ID_BITS;
+
+    struct Route
+    {
+        ZephyrCanTransceiver* _destination;
+        /** the destination ID is (id & ~_rewriteMask) | (_rewriteId & _rewriteMask) */
+        uint32_t _rewriteId;
+        uint32_t _rewriteMask;
+        uint32_t _firstId;
+        uint32_t _lastId;
+        bool _extended;
+        uint32_t _forwarded;
+        /** frames which could not be handed over to the destination controller */
+        uint32_t _dropped;
+    };
+
+    CanRouter();
+
+    /**
+     * Routes the IDs firstId..lastId to the destination bus.
+     * \param rewriteId   bits replacing the ID bits selected by rewriteMask
+     * \param rewriteMask 0 keeps the ID, 0x7FF/0x1FFFFFFF maps all IDs to rewriteId
+     * \return false if the route table is full, an ID is already routed or the range is invalid
+     */
+    bool addRoute(
+        uint32_t firstId,
+        uint32_t lastId,
+        bool extended,
+        ZephyrCanTransceiver& destination,
+        uint32_t rewriteId   = 0U,
+        uint32_t rewriteMask = 0U);
+
+    /**
+     * Forwards the frame if its ID is routed, called from the RX interrupt.
+     * \return true if the frame has been routed (whether or not it could be sent)
+     */
+    bool route(struct can_frame const& frame);
+
+    ::etl::span<Route const> getRoutes() const
+    {
+        return ::etl::span<Route const>(_routes.data(), _routeCount);
+    }
+
+private:
+    static uint8_t const NO_ROUTE = 0xFFU;
+    static uint32_t const NO_ID   = 0xFFFFFFFFU;
+
+    struct ExtendedIdSlot
+    {
+        uint32_t _id;
+        uint8_t _route;
+    };
+
+    static size_t hash(uint32_t id);
+
+    uint8_t findExtended(uint32_t id) const;
+    bool insertExtended(uint32_t id, uint8_t route);
+
+    ::etl::array<uint8_t, CAN_STD_ID_MASK + 1U> _standardIds;
+    ::etl::array<ExtendedIdSlot, EXTENDED_ID_SLOTS> _extendedIds;
+    ::etl::array<Route, MAX_ROUTES> _routes;
+    size_t _routeCount;
+    /** occupied slots of _extendedIds */
+    size_t _extendedIdCount;
+};
+
+} // namespace bios
@@ -0,0 +1,157 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <async/Async.h>
+#include <etl/array.h>
+#include <etl/span.h>
+#include <platform/estdint.h>
+
+namespace bios
+{
+class ZephyrCanTransceiver;
+
+/**
+ * Entry of the static table of a CanRxDeadlineMonitor.
+ */
+struct CanRxDeadline
+{
+    /** CAN ID as built by ::can::CanId::id() */
+    uint32_t _id;
+    /** maximum time between two receptions of the frame */
+    uint16_t _timeoutMs;
+};
+
+/**
+ * Is notified about supervised frames which stopped and started arriving again.
+ * Both calls are made from the sweep of the monitor in its async context.
+ */
+class ICanRxDeadlineListener
+{
+public:
+    /**
+     * \param index index of the frame in the table of the monitor
+     * \param id    CAN ID as built by ::can::CanId::id()
+     */
+    virtual void rxDeadlineMissed(size_t index, uint32_t id) = 0;
+
+    virtual void rxDeadlineRecovered(size_t index, uint32_t id) = 0;
+};
+
+/**
+ * Supervises the reception of cyclic frames on one bus.
+ *
+ * The transceiver stores the time of reception of a supervised ID in the RX interrupt, which
+ * is a binary search in a sorted array of IDs and one store of the uptime in ms. The uptime
+ * rather than the cycle counter keeps the full range of the 16 bit timeouts comparable, a
+ * fast cycle counter wraps within seconds. A single periodic sweep compares
+ * all timestamps with their timeouts, so there is no timer per frame and the sweep cost only
+ * depends on the number of supervised IDs, not on the frame rate.
+ * A frame that was never received times out one timeout after start().
+ * The resolution of the timeouts is the sweep period.
+ */
+class CanRxDeadlineMonitor : private ::async::IRunnable
+{
+public:
+    static size_t const MAX_LISTENERS = 4U;
+
+    struct Supervision
+    {
+        uint32_t _misses;
+        uint16_t _timeoutMs;
+        /** index in the table passed to the constructor */
+        uint16_t _index;
+        bool _missed;
+    };
+
+    /**
+     * \param deadlines     table of supervised IDs, each ID must only be contained once
+     * \param ids           storage for the sorted IDs, same size as deadlines
+     * \param lastSeenMs    storage for the timestamps, same size as deadlines
+     * \param supervisions  storage for the state, same size as deadlines
+     * \param sweepMs       period of the sweep
+     */
+    CanRxDeadlineMonitor(
+        ::etl::span<CanRxDeadline const> deadlines,
+        ::etl::span<uint32_t> ids,
+        ::etl::span<uint32_t> lastSeenMs,
+        ::etl::span<Supervision> supervisions,
+        uint16_t sweepMs);
+
+    /**
+     * \return false if there is no more room for the listener
+     */
+    bool addListener(ICanRxDeadlineListener& listener);
+
+    /**
+     * Starts the supervision of frames received by the given transceiver, the sweep runs in
+     * the given context.
+     */
+    void start(::async::ContextType context, ZephyrCanTransceiver& transceiver);
+
+    void stop();
+
+    /**
+     * Called by the transceiver from the RX interrupt for every received frame.
+     */
+    void frameReceived(uint32_t id, bool extended);
+
+    /** \return number of supervised IDs, the following getters are in the order of the IDs */
+    size_t getSize() const { return _size; }
+
+    uint32_t getId(size_t position) const { return _ids[position]; }
+
+    Supervision const& getSupervision(size_t position) const
+    {
+        return _supervisions[position];
+    }
+
+    /**
+     * \return time since the last reception in ms, not meaningful while the deadline is missed
+     */
+    uint32_t getAgeMs(size_t position) const;
+
+    uint16_t getSweepMs() const { return _sweepMs; }
+
+    ZephyrCanTransceiver const* getTransceiver() const { return _transceiver; }
+
+private:
+    void execute() override;
+
+    void sort();
+    void notify(size_t position, bool missed);
+
+    ::etl::span<CanRxDeadline const> _deadlines;
+    ::etl::span<uint32_t> _ids;
+    ::etl::span<uint32_t> _lastSeenMs;
+    ::etl::span<Supervision> _supervisions;
+    size_t const _size;
+    ::etl::array<ICanRxDeadlineListener*, MAX_LISTENERS> _listeners;
+    size_t _listenerCount;
+    ZephyrCanTransceiver* _transceiver;
+    ::async::TimeoutType _timeout;
+    uint16_t const _sweepMs;
+};
+
+namespace declare
+{
+template<size_t N>
+class CanRxDeadlineMonitor : public ::bios::CanRxDeadlineMonitor
+{
+public:
+    CanRxDeadlineMonitor(CanRxDeadline const (&deadlines)[N], uint16_t const sweepMs)
+    : ::bios::CanRxDeadlineMonitor(deadlines, _ids, _lastSeenMs, _supervisions, sweepMs)
+    , _ids()
+    , _lastSeenMs()
+    , _supervisions()
+    {}
+
+private:
+    uint32_t _ids[N];
+    uint32_t _lastSeenMs[N];
+    Supervision _supervisions[N];
+};
+
+} // namespace declare
+
+} // namespace bios
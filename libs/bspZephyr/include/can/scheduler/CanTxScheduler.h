@@ -0,0 +1,129 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <async/Async.h>
+#include <can/canframes/CANFrame.h>
+#include <etl/array.h>
+#include <etl/span.h>
+#include <platform/estdint.h>
+
+namespace bios
+{
+class ZephyrCanTransceiver;
+
+/**
+ * Entry of the static message table of a CanTxScheduler.
+ */
+struct CanTxMessage
+{
+    /** CAN ID as built by ::can::CanId::id() */
+    uint32_t _id;
+    uint16_t _periodMs;
+    /** first transmission after start(), CanTxScheduler::AUTO_OFFSET staggers automatically */
+    uint16_t _offsetMs;
+    uint8_t _length;
+};
+
+/**
+ * Provides the payload of the cyclic messages of a CanTxScheduler.
+ */
+class ICanTxPayloadProvider
+{
+public:
+    /**
+     * Called right before each transmission of a message.
+     * \param index index of the message in the message table
+     * \param frame frame with ID and length of the table entry, the payload has to be filled
+     */
+    virtual void fillPayload(size_t index, ::can::CANFrame& frame) = 0;
+};
+
+/**
+ * Sends the cyclic messages of a static table on one bus, driven by a single timer.
+ *
+ * All periods and offsets are multiples of the tick. Messages without a fixed offset are
+ * staggered at start() so that as few messages as possible are due in the same tick.
+ * The frames due in a tick are sent with one batch write. For each message the deviation of
+ * the write from its ideal point in time is recorded, jitter is the difference of the
+ * maximum and minimum deviation.
+ */
+class CanTxScheduler : private ::async::IRunnable
+{
+public:
+    static uint16_t const AUTO_OFFSET        = 0xFFFFU;
+    static size_t const MAX_FRAMES_PER_BATCH = 8U;
+
+    /** number of ticks considered when staggering */
+    static size_t const STAGGER_HORIZON_TICKS = 100U;
+
+    struct MessageState
+    {
+        uint32_t _offsetTicks;
+        uint32_t _periodTicks;
+        uint32_t _nextTick;
+        uint32_t _sent;
+        uint32_t _failed;
+        int32_t _minDeviationUs;
+        int32_t _maxDeviationUs;
+    };
+
+    CanTxScheduler(
+        ::etl::span<CanTxMessage const> messages,
+        ::etl::span<MessageState> states,
+        ICanTxPayloadProvider& provider,
+        uint16_t tickMs);
+
+    /**
+     * Starts sending on the given transceiver, the timer runs in the given context.
+     */
+    void start(::async::ContextType context, ZephyrCanTransceiver& transceiver);
+
+    void stop();
+
+    ::etl::span<CanTxMessage const> getMessages() const { return _messages; }
+
+    MessageState const& getState(size_t index) const { return _states[index]; }
+
+    uint16_t getTickMs() const { return _tickMs; }
+
+    ZephyrCanTransceiver const* getTransceiver() const { return _transceiver; }
+
+private:
+    void execute() override;
+
+    static uint32_t findOffset(uint8_t const load[], uint32_t periodTicks);
+
+    void assignOffsets();
+    void send(size_t count);
+
+    ::etl::span<CanTxMessage const> _messages;
+    ::etl::span<MessageState> _states;
+    ICanTxPayloadProvider& _provider;
+    ZephyrCanTransceiver* _transceiver;
+    ::async::TimeoutType _timeout;
+    uint16_t const _tickMs;
+    uint32_t _tick;
+    uint32_t _startUs;
+    ::etl::array<::can::CANFrame, MAX_FRAMES_PER_BATCH> _frames;
+    ::etl::array<size_t, MAX_FRAMES_PER_BATCH> _frameMessages;
+};
+
+namespace declare
+{
+template<size_t N>
+class CanTxScheduler : public ::bios::CanTxScheduler
+{
+public:
+    CanTxScheduler(
+        CanTxMessage const (&messages)[N], ICanTxPayloadProvider& provider, uint16_t const tickMs)
+    : ::bios::CanTxScheduler(messages, _messageStates, provider, tickMs), _messageStates()
+    {}
+
+private:
+    MessageState _messageStates[N];
+};
+
+} // namespace declare
+
+} // namespace bios
@@ -0,0 +1,310 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <can/canframes/CANFrame.h>
+#include <can/filter/IntervalFilter.h>
+#include <can/framemgmt/ICANFrameListener.h>
+#include <etl/type_traits.h>
+#include <platform/estdint.h>
+
+#include <cstring>
+
+namespace bios
+{
+/**
+ * Byte order of a CAN signal as in DBC files.
+ * INTEL:    little endian, the start bit is the least significant bit.
+ * MOTOROLA: big endian, the start bit is the most significant bit and the signal continues
+ *           with bit 7 of the following byte ("sawtooth" bit numbering).
+ */
+enum class CanByteOrder : uint8_t
+{
+    INTEL,
+    MOTOROLA
+};
+
+namespace internal
+{
+/**
+ * Position in the payload (byte * 8 + bit) of the given bit of the signal value.
+ */
+constexpr size_t canSignalBitPosition(
+    CanByteOrder const order, size_t const startBit, size_t const length, size_t const valueBit)
+{
+    if (order == CanByteOrder::INTEL)
+    {
+        return startBit + valueBit;
+    }
+    size_t position = startBit;
+    for (size_t i = valueBit + 1U; i < length; ++i)
+    {
+        position = ((position % 8U) == 0U) ? (position + 15U) : (position - 1U);
+    }
+    return position;
+}
+
+constexpr size_t canSignalByte(
+    CanByteOrder const order, size_t const startBit, size_t const length, bool const last)
+{
+    // the payload bytes increase from the least significant bit for INTEL and from the most
+    // significant bit for MOTOROLA
+    bool const lsb = (order == CanByteOrder::INTEL) != last;
+    return canSignalBitPosition(order, startBit, length, lsb ? 0U : (length - 1U)) / 8U;
+}
+
+/**
+ * Bits of the given payload byte occupied by the signal.
+ */
+constexpr uint8_t canSignalByteMask(
+    CanByteOrder const order, size_t const startBit, size_t const length, size_t const byte)
+{
+    uint32_t mask = 0U;
+    for (size_t i = 0U; i < length; ++i)
+    {
+        size_t const position = canSignalBitPosition(order, startBit, length, i);
+        if ((position / 8U) == byte)
+        {
+            mask |= 1U << (position % 8U);
+        }
+    }
+    return static_cast<uint8_t>(mask);
+}
+
+/**
+ * Distance from the bits of the given payload byte to their position in the signal value,
+ * the bits of one byte are always contiguous and in the same order in the value.
+ */
+constexpr int32_t canSignalByteShift(
+    CanByteOrder const order, size_t const startBit, size_t const length, size_t const byte)
+{
+    for (size_t i = 0U; i < length; ++i)
+    {
+        size_t const position = canSignalBitPosition(order, startBit, length, i);
+        if ((position / 8U) == byte)
+        {
+            return static_cast<int32_t>(i) - static_cast<int32_t>(position % 8U);
+        }
+    }
+    return 0;
+}
+
+} // namespace internal
+
+/**
+ * Codec of a single CAN signal described at compile time, e.g. as generated from a DBC file
+ * by samples/demo_app/dbc_to_signals.py.
+ *
+ * Masks and shifts of all payload bytes are computed at compile time, decode() and encode()
+ * expand to one mask and shift per byte occupied by the signal without any loop or
+ * descriptor lookup at runtime.
+ *
+ * \tparam StartBit start bit as in DBC files, see CanByteOrder
+ * \tparam Length   number of bits, 1..64
+ * \tparam Signed   true for two's complement signals
+ */
+template<size_t StartBit, size_t Length, CanByteOrder Order, bool Signed = false>
+class CanSignal
+{
+    static_assert((Length > 0U) && (Length <= 64U), "invalid signal length");
+
+public:
+    using RawType   = typename ::etl::conditional<(Length <= 32U), uint32_t, uint64_t>::type;
+    using ValueType = typename ::etl::conditional<
+        Signed,
+        typename ::etl::make_signed<RawType>::type,
+        RawType>::type;
+
+    static constexpr size_t FIRST_BYTE = internal::canSignalByte(Order, StartBit, Length, false);
+    static constexpr size_t LAST_BYTE  = internal::canSignalByte(Order, StartBit, Length, true);
+    /** minimum payload length containing the signal */
+    static constexpr size_t MIN_PAYLOAD_LENGTH = LAST_BYTE + 1U;
+
+    static ValueType decode(uint8_t const payload[])
+    {
+        RawType const raw = Bytes<FIRST_BYTE>::decode(payload);
+        if (Signed)
+        {
+            return static_cast<ValueType>((raw ^ SIGN_BIT) - SIGN_BIT);
+        }
+        return static_cast<ValueType>(raw);
+    }
+
+    /**
+     * Writes the signal into the payload, the bits of other signals are kept.
+     * Bits of the value beyond the signal length are ignored.
+     */
+    static void encode(uint8_t payload[], ValueType const value)
+    {
+        Bytes<FIRST_BYTE>::encode(payload, static_cast<RawType>(value));
+    }
+
+private:
+    static constexpr RawType SIGN_BIT = static_cast<RawType>(1U) << (Length - 1U);
+
+    template<size_t Index, bool Last = (Index == LAST_BYTE)>
+    struct Bytes;
+
+    template<size_t Index>
+    struct ByteCodec
+    {
+        static constexpr uint8_t MASK
+            = internal::canSignalByteMask(Order, StartBit, Length, Index);
+        static constexpr int32_t SHIFT
+            = internal::canSignalByteShift(Order, StartBit, Length, Index);
+        static constexpr size_t LEFT  = (SHIFT > 0) ? static_cast<size_t>(SHIFT) : 0U;
+        static constexpr size_t RIGHT = (SHIFT < 0) ? static_cast<size_t>(-SHIFT) : 0U;
+
+        static RawType decode(uint8_t const payload[])
+        {
+            return (static_cast<RawType>(payload[Index] & MASK) << LEFT) >> RIGHT;
+        }
+
+        static void encode(uint8_t payload[], RawType const raw)
+        {
+            payload[Index] = static_cast<uint8_t>(
+                (payload[Index] & static_cast<uint8_t>(~MASK))
+                | (static_cast<uint8_t>((raw >> LEFT) << RIGHT) & MASK));
+        }
+    };
+
+    template<size_t Index>
+    struct Bytes<Index, false>
+    {
+        static RawType decode(uint8_t const payload[])
+        {
+            return ByteCodec<Index>::decode(payload) | Bytes<Index + 1U>::decode(payload);
+        }
+
+        static void encode(uint8_t payload[], RawType const raw)
+        {
+            ByteCodec<Index>::encode(payload, raw);
+            Bytes<Index + 1U>::encode(payload, raw);
+        }
+    };
+
+    template<size_t Index>
+    struct Bytes<Index, true>
+    {
+        static RawType decode(uint8_t const payload[])
+        {
+            return ByteCodec<Index>::decode(payload);
+        }
+
+        static void encode(uint8_t payload[], RawType const raw)
+        {
+            ByteCodec<Index>::encode(payload, raw);
+        }
+    };
+};
+
+/**
+ * CAN signal with a linear conversion to a physical value:
+ * physical = (raw * FactorNumerator + OffsetNumerator) / FactorDenominator,
+ * e.g. factor 0.1 and offset -40 of a DBC file become 1, 10, -400.
+ */
+template<
+    typename Signal,
+    int32_t FactorNumerator,
+    int32_t FactorDenominator = 1,
+    int32_t OffsetNumerator   = 0>
+class CanScaledSignal
+{
+    static_assert((FactorNumerator != 0) && (FactorDenominator > 0), "invalid signal factor");
+
+public:
+    using RawSignal = Signal;
+    using ValueType = typename Signal::ValueType;
+
+    static constexpr size_t MIN_PAYLOAD_LENGTH = Signal::MIN_PAYLOAD_LENGTH;
+
+    static constexpr float FACTOR
+        = static_cast<float>(FactorNumerator) / static_cast<float>(FactorDenominator);
+    static constexpr float OFFSET
+        = static_cast<float>(OffsetNumerator) / static_cast<float>(FactorDenominator);
+
+    static float decode(uint8_t const payload[])
+    {
+        return (static_cast<float>(Signal::decode(payload)) * FACTOR) + OFFSET;
+    }
+
+    /**
+     * Writes the physical value rounded to the nearest raw value, values outside the range of
+     * the signal are not saturated.
+     */
+    static void encode(uint8_t payload[], float const value)
+    {
+        float const raw = (value - OFFSET) / FACTOR;
+        // through int64_t as negative values must not be converted to unsigned directly
+        int64_t const rounded = static_cast<int64_t>((raw < 0.0F) ? (raw - 0.5F) : (raw + 0.5F));
+        Signal::encode(payload, static_cast<ValueType>(rounded));
+    }
+};
+
+/**
+ * CAN message with its signals as nested types, the length is checked against the signals
+ * at compile time.
+ * \tparam Id CAN ID as built by ::can::CanId::id()
+ */
+template<uint32_t Id, uint8_t Length>
+struct CanMessage
+{
+    static constexpr uint32_t ID    = Id;
+    static constexpr uint8_t LENGTH = Length;
+
+    /**
+     * Sets ID and length of the message and clears the payload, for the TX path.
+     */
+    static void init(::can::CANFrame& frame)
+    {
+        frame.setId(ID);
+        frame.setPayloadLength(LENGTH);
+        memset(frame.getPayload(), 0, LENGTH);
+    }
+
+    template<typename Signal>
+    static auto get(uint8_t const payload[]) -> decltype(Signal::decode(payload))
+    {
+        static_assert(Signal::MIN_PAYLOAD_LENGTH <= LENGTH, "signal exceeds the message");
+        return Signal::decode(payload);
+    }
+
+    template<typename Signal, typename T>
+    static void set(uint8_t payload[], T const value)
+    {
+        static_assert(Signal::MIN_PAYLOAD_LENGTH <= LENGTH, "signal exceeds the message");
+        Signal::encode(payload, value);
+    }
+};
+
+/**
+ * Frame listener receiving one CanMessage, frames shorter than the message are ignored.
+ */
+template<typename Message>
+class CanMessageListener : public ::can::ICANFrameListener
+{
+public:
+    CanMessageListener() : _filter(Message::ID, Message::ID) {}
+
+    void frameReceived(::can::CANFrame const& frame) final
+    {
+        if (frame.getPayloadLength() >= Message::LENGTH)
+        {
+            messageReceived(frame.getPayload());
+        }
+    }
+
+    ::can::IFilter& getFilter() final { return _filter; }
+
+protected:
+    /**
+     * Called from the receive task of the transceiver, read the signals with
+     * Message::get<Signal>(payload).
+     */
+    virtual void messageReceived(uint8_t const payload[]) = 0;
+
+private:
+    ::can::IntervalFilter _filter;
+};
+
+} // namespace bios
@@ -0,0 +1,156 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <can/canframes/CANFrame.h>
+#include <can/framemgmt/ICANFrameListener.h>
+
+#include <etl/array.h>
+#include <platform/estdint.h>
+
+/** maximum number of listeners of a dispatcher, has to be below 256 */
+#ifndef CAN_DISPATCHER_MAX_LISTENERS
+#define CAN_DISPATCHER_MAX_LISTENERS 128U
+#endif
+
+/** maximum number of distinct listener sets of a dispatcher, has to be below 256 */
+#ifndef CAN_DISPATCHER_MAX_LISTENER_SETS
+#define CAN_DISPATCHER_MAX_LISTENER_SETS 128U
+#endif
+
+/** total number of listener references of all listener sets of a dispatcher */
+#ifndef CAN_DISPATCHER_LISTENER_POOL_SIZE
+#define CAN_DISPATCHER_LISTENER_POOL_SIZE 512U
+#endif
+
+/** number of buckets of the extended ID cache is 2^CAN_DISPATCHER_EXTENDED_ID_CACHE_BITS */
+#ifndef CAN_DISPATCHER_EXTENDED_ID_CACHE_BITS
+#define CAN_DISPATCHER_EXTENDED_ID_CACHE_BITS 5U
+#endif
+
+namespace bios
+{
+/**
+ * Delivers received frames to the listeners whose filter matches, for standard IDs and cached
+ * extended IDs with a cost that does not depend on the number of registered listeners.
+ *
+ * The filters of all listeners are evaluated once per ID, the resulting listener sets are
+ * stored deduplicated. Standard IDs are mapped to their set by a table that is built when the
+ * listeners change, extended IDs by a two-way set associative cache of the IDs seen so far. An
+ * extended ID missing in the cache costs one evaluation of all filters, so the cache should
+ * hold the extended IDs received cyclically. Filters are expected not to change while their
+ * listener is registered.
+ *
+ * addListener() and removeListener() may be called from any context and update the index in
+ * the calling context: adding a listener evaluates its filter for all 2048 standard IDs,
+ * removing one renumbers the listeners of the sets. Other changes, e.g. by several contexts
+ * at once, or a full pool rebuild the index from the filters of all listeners. Meanwhile
+ * dispatch() returns false and the caller notifies the listeners itself. dispatch() has to be
+ * called from a single context.
+ *
+ * With the default sizes a dispatcher takes about 4.6 KB of RAM on a 32 bit target, 2 KB of
+ * it for the standard ID table, the other tables can be sized by the CAN_DISPATCHER_ defines.
+ */
+class CanFrameDispatcher
+{
+public:
+    static size_t const MAX_LISTENERS     = CAN_DISPATCHER_MAX_LISTENERS;
+    static size_t const MAX_LISTENER_SETS = CAN_DISPATCHER_MAX_LISTENER_SETS;
+    /** total number of listener references of all listener sets */
+    static size_t const LISTENER_POOL_SIZE = CAN_DISPATCHER_LISTENER_POOL_SIZE;
+    /** number of buckets of the extended ID cache is 2^EXTENDED_ID_CACHE_BITS */
+    static uint32_t const EXTENDED_ID_CACHE_BITS = CAN_DISPATCHER_EXTENDED_ID_CACHE_BITS;
+    static size_t const EXTENDED_ID_CACHE_WAYS   = 2U;
+    static size_t const EXTENDED_ID_CACHE_SIZE
+        = EXTENDED_ID_CACHE_WAYS << EXTENDED_ID_CACHE_BITS;
+
+    CanFrameDispatcher();
+
+    /**
+     * \param first true for listeners which are notified before all others
+     */
+    void addListener(::can::ICANFrameListener& listener, bool first);
+    void removeListener(::can::ICANFrameListener& listener);
+
+    /**
+     * Notifies the listeners of the frame.
+     * \return false if the frame has not been dispatched because the capacity of the index is
+     *         exceeded or the index is being rebuilt, the caller then has to notify the
+     *         listeners itself
+     */
+    bool dispatch(::can::CANFrame const& frame);
+
+private:
+    static uint8_t const NO_SET      = 0xFFU;
+    static uint8_t const EMPTY_SET   = 0U;
+    static uint8_t const NO_LISTENER = 0xFFU;
+    static uint32_t const NO_ID      = 0xFFFFFFFFU;
+
+    struct ListenerSet
+    {
+        uint16_t _offset;
+        uint8_t _count;
+    };
+
+    struct ExtendedIdEntry
+    {
+        uint32_t _id;
+        uint8_t _set;
+    };
+
+    using Listeners = ::etl::array<::can::ICANFrameListener*, MAX_LISTENERS>;
+
+    /** change of the registered listeners compared to the indexed ones */
+    enum class Change : uint8_t
+    {
+        REMOVED,
+        ADDED_FIRST,
+        ADDED_LAST,
+        OTHER
+    };
+
+    static size_t hash(uint32_t id);
+
+    /**
+     * Rebuilds the index until no change is pending, unless a rebuild or dispatch() is
+     * running, which then picks up the change.
+     */
+    void update();
+    /** \param map new index of each indexed listener, NO_LISTENER if it has been removed */
+    Change compare(uint8_t map[]) const;
+    /** \return false if the index has to be rebuilt */
+    bool apply(Change change, uint8_t const map[]);
+    void remapSets(uint8_t const map[]);
+    /** \return false if the capacity of the index is exceeded */
+    bool addToSets(size_t index);
+    void resetExtendedIds();
+    /** \return false if the capacity of the index is exceeded */
+    bool rebuild();
+    uint8_t getSet(uint32_t id);
+    uint8_t matchListeners(uint32_t id, uint8_t indices[]) const;
+    uint8_t findOrAddSet(uint8_t const indices[], uint8_t count);
+
+    // modified by addListener()/removeListener()
+    Listeners _registered;
+    size_t _registeredCount;
+    bool _overflow;
+    bool _changed;
+    // guard the index below, changed under lock
+    bool _updating;
+    bool _dispatching;
+
+    // used by update() while _valid is false, by dispatch() while it is true
+    Listeners _listeners;
+    size_t _listenerCount;
+    bool _valid;
+    /** the index matches _listeners */
+    bool _built;
+    ::etl::array<ListenerSet, MAX_LISTENER_SETS> _sets;
+    size_t _setCount;
+    ::etl::array<uint8_t, LISTENER_POOL_SIZE> _pool;
+    size_t _poolUsed;
+    ::etl::array<uint8_t, 0x800U> _standardIds;
+    ::etl::array<ExtendedIdEntry, EXTENDED_ID_CACHE_SIZE> _extendedIds;
+};
+
+} // namespace bios
@@ -0,0 +1,29 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <zephyr/drivers/can.h>
+
+namespace bios
+{
+class ZephyrCanTransceiver;
+
+/**
+ * Handler for latency critical frames, called directly from the RX interrupt of the
+ * transceiver it is registered at, see ZephyrCanTransceiver::addFastPathHandler().
+ * Implementations must not block and should stay well within the registered time budget.
+ */
+class ICanFastPathHandler
+{
+public:
+    /**
+     * \param frame       received frame, only valid during the call
+     * \param transceiver transceiver that received the frame, frames can be sent with
+     *                    ZephyrCanTransceiver::forward()
+     * \return true if the frame has been consumed and is not passed to the frame listeners
+     */
+    virtual bool frameReceivedInIsr(struct can_frame const& frame, ZephyrCanTransceiver& transceiver)
+        = 0;
+};
+
+} // namespace bios
@@ -7,10 +7,15 @@
 #include <bsp/timer/SystemTimer.h>
 #include <can/canframes/CANFrame.h>
 #include <can/canframes/ICANFrameSentListener.h>
+#include <can/filter/ExtendedIdFilter.h>
 #include <can/framemgmt/IFilteredCANFrameSentListener.h>
 #include <can/transceiver/AbstractCANTransceiver.h>
+#include <can/transceiver/CanFrameDispatcher.h>
+#include <can/transceiver/ICanFastPathHandler.h>
+#include <etl/array.h>
 #include <etl/deque.h>
 #include <etl/queue.h>
+#include <etl/span.h>
 #include <etl/uncopyable.h>
 #include <platform/estdint.h>
 #include <zephyr/drivers/can.h>
@@ -20,18 +25,45 @@ struct device;
 
 namespace bios
 {
+class CanRouter;
+class CanRxDeadlineMonitor;
+
 class ZephyrCanTransceiver
 : public can::AbstractCANTransceiver
 , public ::etl::uncopyable
 {
 
 public:
+    /**
+     * Frame format used for transmission.
+     * CLASSIC: classic CAN frames with up to 8 bytes payload.
+     * FD:      CAN FD frames with up to 64 bytes payload and bit rate switching.
+     */
+    enum class FrameFormat : uint8_t
+    {
+        CLASSIC,
+        FD
+    };
+
     ZephyrCanTransceiver(
         ::async::ContextType context,
         uint8_t busId,
         const struct device *const canDevice,
         uint32_t baudRate);
 
+    /**
+     * \param format       frame format used on this bus
+     * \param dataBaudRate bit rate of the data phase for FD frames, 0 keeps the bit rate
+     *                     configured by the driver
+     */
+    ZephyrCanTransceiver(
+        ::async::ContextType context,
+        uint8_t busId,
+        const struct device *const canDevice,
+        uint32_t baudRate,
+        FrameFormat format,
+        uint32_t dataBaudRate);
+
     ::can::ICanTransceiver::ErrorCode init() override;
     ::can::ICanTransceiver::ErrorCode open(::can::CANFrame const& frame) override;
     ::can::ICanTransceiver::ErrorCode open() override;
@@ -43,11 +75,37 @@ public:
     ::can::ICanTransceiver::ErrorCode
     write(can::CANFrame const& frame, can::ICANFrameSentListener& listener) override;
 
+    /**
+     * Writes several frames without sent listener under a single lock. Frames are handed over
+     * to the controller as long as TX buffers are free, the rest is queued and sent from the
+     * TX complete interrupt. The registered sent listeners are notified for every frame
+     * before the call returns, as for write(frame).
+     * \param frames  frames to send in this order
+     * \param results optional, results[i] receives the result of frames[i]
+     * \return number of frames sent or queued
+     */
+    size_t write(::etl::span<::can::CANFrame const> frames, ::etl::span<ErrorCode> results);
+
+    /**
+     * The listeners are additionally registered at the frame dispatcher which notifies them
+     * without evaluating the filters of all listeners per frame.
+     */
+    void addCANFrameListener(::can::ICANFrameListener& listener) override;
+    void addVIPCANFrameListener(::can::ICANFrameListener& listener) override;
+    void removeCANFrameListener(::can::ICANFrameListener& listener) override;
+
     ErrorCode mute() override;
     ErrorCode unmute() override;
 
     uint32_t getBaudrate() const override;
 
+    /**
+     * \return the bit rate of the data phase, equals getBaudrate() for classic CAN
+     */
+    uint32_t getDataBaudrate() const;
+
+    FrameFormat getFrameFormat() const { return _format; }
+
     /**
      * \return the the Hardware Queue Timeout.
      */
@@ -66,18 +124,152 @@ public:
     uint32_t getOverrunCount() const { return _overrunCount; }
 
     /**
-     * cyclicTask()
+     * \return time in us (time base of getSystemTimeUs32Bit()) at which the transmission of the
+     * last frame written with a sent listener has been completed. Within
+     * ICANFrameSentListener::canFrameSent() this is the TX timestamp of the reported frame.
+     */
+    uint32_t getTxTimestamp() const;
+
+    /** number of buckets of the write-to-TX-complete latency histogram */
+    static size_t const TX_LATENCY_BUCKET_COUNT = 8U;
+
+    /**
+     * Cumulative traffic statistics of the transceiver. All counters wrap around, rates are
+     * obtained from the difference of two snapshots.
+     * Bit times are the estimated frame lengths in nominal bit times without stuff bits,
+     * the bus load is the sum of RX and TX bit times per second divided by the bit rate.
+     */
+    struct Statistics
+    {
+        uint32_t _rxFrames;
+        uint32_t _rxBitTimes;
+        /** frames lost because the receive queue was full */
+        uint32_t _rxDropped;
+        uint32_t _txFrames;
+        uint32_t _txBitTimes;
+        /** frames reported as failed by the driver after they have been handed over */
+        uint32_t _txErrors;
+        /** frames rejected by write() because no TX buffer was free */
+        uint32_t _txOverruns;
+        /** maximum number of frames pending in the driver and the TX queue at the same time */
+        uint8_t _txQueueHighWater;
+        /**
+         * write-to-TX-complete latency of frames with sent listener, see
+         * getTxLatencyBucketLimitUs()
+         */
+        ::etl::array<uint32_t, TX_LATENCY_BUCKET_COUNT> _txLatency;
+    };
+
+    /**
+     * Copies a consistent snapshot of the statistics.
+     */
+    void getStatistics(Statistics& statistics) const;
+
+    /**
+     * Reads state and error counters from the controller.
+     * \return true if the controller provided the values
+     */
+    bool getErrorCounters(can_state& state, can_bus_err_cnt& errCnt) const;
+
+    /**
+     * \return exclusive upper latency bound in us of the given histogram bucket,
+     *         UINT32_MAX for the last bucket
+     */
+    static uint32_t getTxLatencyBucketLimitUs(size_t bucket);
+
+    /**
+     * Bus-off recovery strategy.
+     * AUTOMATIC: the controller recovers on its own after 128 occurrences of 11 recessive bits.
+     * MANUAL:    recovery is started by the transceiver after the delays of a backoff schedule,
+     *            requires CONFIG_CAN_MANUAL_RECOVERY_MODE.
+     */
+    enum class BusOffRecovery : uint8_t
+    {
+        AUTOMATIC,
+        MANUAL
+    };
+
+    /**
+     * Configures the bus-off recovery, has to be called before init().
+     * \param recovery  recovery strategy
+     * \param backoffMs delays in ms before the consecutive recovery attempts in MANUAL mode,
+     *                  the last delay is repeated until the bus has recovered
+     */
+    void setBusOffRecovery(BusOffRecovery recovery, ::etl::span<uint16_t const> backoffMs);
+
+    /**
+     * Sets the acceptance filter for received extended frames, which is evaluated in the RX
+     * interrupt before a frame is queued. By default all extended frames are accepted.
+     * Standard frames are filtered by the merged filters of the frame listeners.
+     */
+    void setExtendedIdFilter(ExtendedIdFilter const& filter);
+
+    /**
+     * Sets the router which forwards received frames to other buses, nullptr disables routing.
+     * The router is called from the RX interrupt before the frame is queued for the listeners.
+     */
+    void setRouter(CanRouter* router) { _router = router; }
+
+    CanRouter const* getRouter() const { return _router; }
+
+    /**
+     * Sets the monitor which is told about every received frame from the RX interrupt,
+     * regardless of filters and fast path handlers, nullptr disables the supervision.
+     * Called by CanRxDeadlineMonitor::start() and stop().
+     */
+    void setRxDeadlineMonitor(CanRxDeadlineMonitor* monitor) { _rxDeadlineMonitor = monitor; }
+
+    /** maximum number of fast path handlers per transceiver */
+    static size_t const MAX_FAST_PATH_HANDLERS = 4U;
+
+    /**
+     * Fast path handler registration with its execution statistics.
+     */
+    struct FastPathHandler
+    {
+        ICanFastPathHandler* _handler;
+        uint32_t _id;
+        bool _extended;
+        /** false after the first overrun, frames then go to the listeners */
+        bool _enabled;
+        uint8_t _overruns;
+        uint32_t _budgetCycles;
+        uint32_t _calls;
+        uint32_t _maxCycles;
+    };
+
+    /**
+     * Registers a handler which is called directly from the RX interrupt for frames with the
+     * given ID, before the frame is queued for the listeners. The budget is monitored, not
+     * enforced: a running call can't be interrupted, but its execution time is measured and a
+     * handler whose call exceeded the budget is disabled before its next frame.
+     * \param budgetUs maximum execution time of a call in us
+     * \return false if there is no more room for the handler
+     */
+    bool addFastPathHandler(
+        uint32_t id, bool extended, ICanFastPathHandler& handler, uint32_t budgetUs);
+
+    ::etl::span<FastPathHandler const> getFastPathHandlers() const
+    {
+        return ::etl::span<FastPathHandler const>(_fastPathHandlers.data(), _fastPathHandlerCount);
+    }
+
+    /**
+     * Hands a frame directly over to the controller, without sent listeners and without
+     * TX queue. Used for frames received on another bus and for answers of fast path
+     * handlers, may be called from interrupt context.
+     * \return true if the frame has been accepted by the controller
+     */
+    bool forward(struct can_frame const& frame);
+
+    /**
+     * stateChangeTask()
      *
-     * it is called periodically after the expiration of time set
-     * by ITimeouListener::setTimeout
-     * It calls the services which are to be called
-     * with a period of the set timeout.
-     * Transceiver error pins and bus state are checked by this
-     * function and their respective values are stored and the
-     * respective listeners informed if unexpected states have been
-     * encountered
+     * Executed in the context of the transceiver whenever the controller reports a change
+     * of the bus state. The state listeners are informed about the new transceiver state and
+     * bus-off recovery is triggered according to the configured strategy.
      */
-    void cyclicTask();
+    void stateChangeTask();
 
     void receiveTask();
 
@@ -85,12 +277,29 @@ public:
 
     static void transmitCallback(const struct device *dev, int error, void *user_data);
 
+    /** TX complete of a frame without sent listener, the user data is the transceiver */
+    static void transmitDoneCallback(const struct device *dev, int error, void *user_data);
+
+    static void stateChangeCallback(
+        const struct device *dev, enum can_state state, struct can_bus_err_cnt errCnt, void *user_data);
+
 private:
-    /** polling time */
-    static uint32_t const ERROR_POLLING_TIMEOUT = 10;
     static uint8_t const RX_QUEUE_SIZE          = 32;
+    /**
+     * number of frames with sent listener pending in the driver at the same time, only the
+     * front job of the TX queue is handed over
+     */
+    static uint8_t const TX_SLOT_COUNT          = 1;
+    /** number of frames of batch writes waiting for a free TX slot */
+    static uint8_t const TX_BATCH_QUEUE_SIZE    = 16;
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+    /** bound for the interrupt latency used to validate controller timestamps */
+    static int32_t const MAX_RX_LATENCY_US      = 500;
+#endif
 
     static can_filter const MatchAllCanFilter;
+    static can_filter const MatchAllExtendedCanFilter;
+    static uint32_t const TX_LATENCY_BUCKET_LIMITS_US[TX_LATENCY_BUCKET_COUNT];
 
     struct TxJobWithCallback
     {
@@ -103,32 +312,117 @@ private:
     };
 
     using TxQueue = ::etl::deque<TxJobWithCallback, 3>;
+    using TxBatchQueue = ::etl::queue<struct can_frame, TX_BATCH_QUEUE_SIZE>;
+
+    /**
+     * Context of a frame with sent listener handed over to the driver, passed as user data of
+     * can_send(). Frames without sent listener don't take a slot, so they are only limited by
+     * the TX buffers of the driver.
+     */
+    struct TxSlot
+    {
+        ZephyrCanTransceiver* _transceiver;
+        uint32_t _writeTicks;
+        uint32_t _completeTicks;
+        uint32_t _bitTimes;
+        bool _used;
+    };
+
+    /**
+     * Received frame. The timestamp of the frame holds the raw tick count of the ISR until it
+     * is converted in receiveTask().
+     */
+    struct RxFrame
+    {
+        ::can::CANFrame _frame;
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+        uint16_t _hwTimestamp;
+#endif
+    };
+
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+    /** Relation between the controller timestamp and the system time. */
+    struct RxTimestampSync
+    {
+        uint16_t _hwTimestamp;
+        uint32_t _timeUs;
+        bool _valid;
+    };
+#endif
 
     const struct device *const _canDevice;
     uint32_t _baudRate;
+    uint32_t _dataBaudRate;
+    FrameFormat const _format;
 
-    ::etl::queue<can::CANFrame, RX_QUEUE_SIZE> _rxQueue;
+    ::etl::queue<RxFrame, RX_QUEUE_SIZE> _rxQueue;
+    CanFrameDispatcher _dispatcher;
     int _rxFilterId;
+    int _rxExtendedFilterId;
+    ExtendedIdFilter _extendedIdFilter;
 
     uint16_t _txOfflineErrors;
     uint32_t _overrunCount;
     uint32_t _framesSentCount;
 
     TxQueue _txQueue;
+    TxBatchQueue _txBatchQueue;
+    ::etl::array<TxSlot, TX_SLOT_COUNT> _txSlots;
+    uint8_t _txSlotsUsed;
+    /** frames without sent listener pending in the driver */
+    uint8_t _txFramesInDriver;
+    /** TX complete of the frame reported to the last sent listener, copied from its slot */
+    uint32_t _txTimestampTicks;
+    Statistics _statistics;
 
     ::async::ContextType const _context;
-    ::async::Function _cyclicTask;
+    ::async::Function _stateChangeTask;
     ::async::Function _receiveTask;
-    ::async::TimeoutType _cyclicTaskTimeout;
-
-    void buildCanFrame(can_frame& canFrame, ::can::CANFrame const& frame);
+    ::async::Function _recoveryTask;
+    ::async::TimeoutType _recoveryTimeout;
+
+    can_state _canState;
+    BusOffRecovery _busOffRecovery;
+    ::etl::span<uint16_t const> _recoveryBackoffMs;
+    uint8_t _recoveryAttempt;
+    CanRouter* _router;
+    CanRxDeadlineMonitor* _rxDeadlineMonitor;
+    ::etl::array<FastPathHandler, MAX_FAST_PATH_HANDLERS> _fastPathHandlers;
+    size_t _fastPathHandlerCount;
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+    RxTimestampSync _rxTimestampSync;
+#endif
+
+    bool buildCanFrame(can_frame& canFrame, ::can::CANFrame const& frame) const;
     can::ICanTransceiver::ErrorCode
     write(can::CANFrame const& frame, can::ICANFrameSentListener* pListener);
     uint8_t enqueueRxFrame(
-        uint32_t id, uint8_t length, uint8_t payload[], bool extended, uint8_t const* filterMap);
-
-    void canFrameSentCallback(int error);
+        uint32_t id,
+        uint8_t length,
+        uint8_t payload[],
+        bool extended,
+        uint8_t const* filterMap,
+        uint16_t hwTimestamp);
+    uint32_t getRxTimestamp(RxFrame const& rxFrame);
+
+    ErrorCode writeOrQueue(::can::CANFrame const& frame);
+    void sendBatchQueue();
+
+    /** Hands over a frame without sent listener to the driver, \return result of can_send() */
+    int sendFrame(struct can_frame const& canFrame);
+    TxSlot* acquireTxSlot(struct can_frame const& canFrame);
+    void releaseTxSlot(TxSlot& slot);
+    void updateTxQueueHighWater();
+    uint32_t getFrameBitTimes(struct can_frame const& frame) const;
+
+    void canFrameSentCallback(TxSlot& slot, int error);
+    void canFrameDoneCallback(int error);
     void canFrameReceivedCallback(struct can_frame *frame);
+    bool runFastPathHandler(struct can_frame const& frame);
+    void canStateChangedCallback(enum can_state state);
+
+    void recoveryTask();
+    void scheduleRecovery();
 
     void notifyRegisteredSentListener(can::CANFrame const& frame) { notifySentListeners(frame); }
 };
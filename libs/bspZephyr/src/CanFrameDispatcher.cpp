@@ -0,0 +1,398 @@
+// Copyright 2025 Accenture.
+
+#include "can/transceiver/CanFrameDispatcher.h"
+
+#include <async/Types.h>
+#include <can/canframes/CanId.h>
+
+#include <string.h>
+
+namespace bios
+{
+static_assert(CanFrameDispatcher::MAX_LISTENERS < 0x100U, "listener index has to fit into uint8_t");
+static_assert(CanFrameDispatcher::MAX_LISTENER_SETS < 0x100U, "set index has to fit into uint8_t");
+static_assert(
+    (CanFrameDispatcher::EXTENDED_ID_CACHE_BITS > 0U)
+        && (CanFrameDispatcher::EXTENDED_ID_CACHE_BITS < 32U),
+    "extended ID cache needs 1 to 31 bits");
+
+size_t const CanFrameDispatcher::MAX_LISTENERS;
+size_t const CanFrameDispatcher::MAX_LISTENER_SETS;
+size_t const CanFrameDispatcher::LISTENER_POOL_SIZE;
+uint32_t const CanFrameDispatcher::EXTENDED_ID_CACHE_BITS;
+size_t const CanFrameDispatcher::EXTENDED_ID_CACHE_WAYS;
+size_t const CanFrameDispatcher::EXTENDED_ID_CACHE_SIZE;
+uint8_t const CanFrameDispatcher::NO_SET;
+uint8_t const CanFrameDispatcher::EMPTY_SET;
+uint8_t const CanFrameDispatcher::NO_LISTENER;
+uint32_t const CanFrameDispatcher::NO_ID;
+
+CanFrameDispatcher::CanFrameDispatcher()
+: _registered()
+, _registeredCount(0U)
+, _overflow(false)
+, _changed(true)
+, _updating(false)
+, _dispatching(false)
+, _listeners()
+, _listenerCount(0U)
+, _valid(false)
+, _built(false)
+, _sets()
+, _setCount(0U)
+, _pool()
+, _poolUsed(0U)
+, _standardIds()
+, _extendedIds()
+{}
+
+void CanFrameDispatcher::addListener(::can::ICANFrameListener& listener, bool const first)
+{
+    {
+        ::async::LockType const lock;
+        if (_registeredCount >= MAX_LISTENERS)
+        {
+            _overflow = true;
+        }
+        else if (first)
+        {
+            for (size_t i = _registeredCount; i > 0U; --i)
+            {
+                _registered[i] = _registered[i - 1U];
+            }
+            _registered[0] = &listener;
+            ++_registeredCount;
+        }
+        else
+        {
+            _registered[_registeredCount] = &listener;
+            ++_registeredCount;
+        }
+        _changed = true;
+    }
+    update();
+}
+
+void CanFrameDispatcher::removeListener(::can::ICANFrameListener& listener)
+{
+    {
+        ::async::LockType const lock;
+        size_t count = 0U;
+        for (size_t i = 0U; i < _registeredCount; ++i)
+        {
+            if (_registered[i] != &listener)
+            {
+                _registered[count] = _registered[i];
+                ++count;
+            }
+        }
+        _registeredCount = count;
+        _changed         = true;
+    }
+    update();
+}
+
+bool CanFrameDispatcher::dispatch(::can::CANFrame const& frame)
+{
+    {
+        ::async::LockType const lock;
+        if (!_valid)
+        {
+            return false;
+        }
+        _dispatching = true;
+    }
+
+    uint8_t const set = getSet(frame.getId());
+    if (NO_SET != set)
+    {
+        ListenerSet const& listenerSet = _sets[set];
+        for (size_t i = 0U; i < listenerSet._count; ++i)
+        {
+            _listeners[_pool[listenerSet._offset + i]]->frameReceived(frame);
+        }
+    }
+
+    bool changed;
+    {
+        ::async::LockType const lock;
+        _dispatching = false;
+        changed      = _changed;
+    }
+    if (changed)
+    {
+        // a listener was added or removed by a context which interrupted the dispatch
+        update();
+    }
+    return (NO_SET != set);
+}
+
+void CanFrameDispatcher::update()
+{
+    ::async::ModifiableLockType lock;
+    if (_updating || _dispatching)
+    {
+        return;
+    }
+    _updating = true;
+    while (_changed)
+    {
+        uint8_t map[MAX_LISTENERS];
+        Change const change = _built ? compare(map) : Change::OTHER;
+        _changed            = false;
+        _valid              = false;
+        _listenerCount      = _registeredCount;
+        _listeners          = _registered;
+        bool const overflow = _overflow;
+        lock.unlock();
+        // filter evaluation is done outside of the lock
+        resetExtendedIds();
+        bool const built = (!overflow) && (apply(change, map) || rebuild());
+        lock.lock();
+        _built = built;
+        _valid = built;
+    }
+    _updating = false;
+}
+
+CanFrameDispatcher::Change CanFrameDispatcher::compare(uint8_t map[]) const
+{
+    size_t const size = _listenerCount * sizeof(_listeners[0]);
+    if (_registeredCount == (_listenerCount + 1U))
+    {
+        if (0 == memcmp(&_registered[1], &_listeners[0], size))
+        {
+            for (size_t i = 0U; i < _listenerCount; ++i)
+            {
+                map[i] = static_cast<uint8_t>(i + 1U);
+            }
+            return Change::ADDED_FIRST;
+        }
+        return (0 == memcmp(&_registered[0], &_listeners[0], size)) ? Change::ADDED_LAST
+                                                                     : Change::OTHER;
+    }
+    // removeListener() keeps the order of the remaining listeners
+    size_t count = 0U;
+    for (size_t i = 0U; i < _listenerCount; ++i)
+    {
+        if ((count < _registeredCount) && (_registered[count] == _listeners[i]))
+        {
+            map[i] = static_cast<uint8_t>(count);
+            ++count;
+        }
+        else
+        {
+            map[i] = NO_LISTENER;
+        }
+    }
+    return (count == _registeredCount) ? Change::REMOVED : Change::OTHER;
+}
+
+bool CanFrameDispatcher::apply(Change const change, uint8_t const map[])
+{
+    switch (change)
+    {
+        case Change::REMOVED:
+        {
+            remapSets(map);
+            return true;
+        }
+        case Change::ADDED_FIRST:
+        {
+            remapSets(map);
+            return addToSets(0U);
+        }
+        case Change::ADDED_LAST:
+        {
+            return addToSets(_listenerCount - 1U);
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+void CanFrameDispatcher::remapSets(uint8_t const map[])
+{
+    for (size_t set = 1U; set < _setCount; ++set)
+    {
+        ListenerSet& listenerSet = _sets[set];
+        uint8_t* const entries   = &_pool[listenerSet._offset];
+        uint8_t count            = 0U;
+        for (size_t i = 0U; i < listenerSet._count; ++i)
+        {
+            if (NO_LISTENER != map[entries[i]])
+            {
+                entries[count] = map[entries[i]];
+                ++count;
+            }
+        }
+        listenerSet._count = count;
+    }
+}
+
+bool CanFrameDispatcher::addToSets(size_t const index)
+{
+    // a set gaining the listener is copied once, the previous set stays in the pool
+    uint8_t added[MAX_LISTENER_SETS];
+    (void)memset(added, NO_SET, sizeof(added));
+    uint8_t indices[MAX_LISTENERS];
+    for (uint32_t id = 0U; id < _standardIds.size(); ++id)
+    {
+        if (!_listeners[index]->getFilter().match(id))
+        {
+            continue;
+        }
+        uint8_t const set = _standardIds[id];
+        if (NO_SET == added[set])
+        {
+            ListenerSet const& listenerSet = _sets[set];
+            uint8_t const* const entries   = &_pool[listenerSet._offset];
+            uint8_t count                  = 0U;
+            // the indices are sorted in the order of notification
+            for (size_t i = 0U; i < listenerSet._count; ++i)
+            {
+                if ((count == i) && (entries[i] > index))
+                {
+                    indices[count] = static_cast<uint8_t>(index);
+                    ++count;
+                }
+                indices[count] = entries[i];
+                ++count;
+            }
+            if (count == listenerSet._count)
+            {
+                indices[count] = static_cast<uint8_t>(index);
+                ++count;
+            }
+            added[set] = findOrAddSet(indices, count);
+            if (NO_SET == added[set])
+            {
+                return false;
+            }
+        }
+        _standardIds[id] = added[set];
+    }
+    return true;
+}
+
+size_t CanFrameDispatcher::hash(uint32_t const id)
+{
+    // Fibonacci hashing, the upper bits of the product are well mixed
+    return static_cast<size_t>((id * 2654435761U) >> (32U - EXTENDED_ID_CACHE_BITS));
+}
+
+void CanFrameDispatcher::resetExtendedIds()
+{
+    for (auto& entry : _extendedIds)
+    {
+        entry._id  = NO_ID;
+        entry._set = NO_SET;
+    }
+}
+
+bool CanFrameDispatcher::rebuild()
+{
+    _sets[EMPTY_SET]._offset = 0U;
+    _sets[EMPTY_SET]._count  = 0U;
+    _setCount                = 1U;
+    _poolUsed                = 0U;
+
+    uint8_t indices[MAX_LISTENERS];
+    for (uint32_t id = 0U; id < _standardIds.size(); ++id)
+    {
+        uint8_t const count = matchListeners(id, indices);
+        // neighbouring IDs mostly share the listeners of the previous one
+        ListenerSet const* const previous = (id > 0U) ? &_sets[_standardIds[id - 1U]] : nullptr;
+        if ((previous != nullptr) && (previous->_count == count)
+            && (0 == memcmp(&_pool[previous->_offset], indices, count)))
+        {
+            _standardIds[id] = _standardIds[id - 1U];
+        }
+        else
+        {
+            uint8_t const set = findOrAddSet(indices, count);
+            if (NO_SET == set)
+            {
+                return false;
+            }
+            _standardIds[id] = set;
+        }
+    }
+    return true;
+}
+
+uint8_t CanFrameDispatcher::getSet(uint32_t const id)
+{
+    if (!::can::CanId::isExtended(id))
+    {
+        return _standardIds[::can::CanId::rawId(id) & (_standardIds.size() - 1U)];
+    }
+    // the first entry of a bucket is the one used most recently
+    ExtendedIdEntry* const bucket = &_extendedIds[hash(id) * EXTENDED_ID_CACHE_WAYS];
+    if (bucket[0]._id == id)
+    {
+        return bucket[0]._set;
+    }
+    ExtendedIdEntry entry = bucket[1];
+    if (entry._id != id)
+    {
+        uint8_t indices[MAX_LISTENERS];
+        uint8_t const count = matchListeners(id, indices);
+        uint8_t const set   = findOrAddSet(indices, count);
+        if (NO_SET == set)
+        {
+            return NO_SET;
+        }
+        // replaces the entry used least recently
+        entry._id  = id;
+        entry._set = set;
+    }
+    bucket[1] = bucket[0];
+    bucket[0] = entry;
+    return entry._set;
+}
+
+uint8_t CanFrameDispatcher::matchListeners(uint32_t const id, uint8_t indices[]) const
+{
+    uint8_t count = 0U;
+    for (size_t i = 0U; i < _listenerCount; ++i)
+    {
+        if (_listeners[i]->getFilter().match(id))
+        {
+            indices[count] = static_cast<uint8_t>(i);
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint8_t CanFrameDispatcher::findOrAddSet(uint8_t const indices[], uint8_t const count)
+{
+    if (0U == count)
+    {
+        return EMPTY_SET;
+    }
+    for (size_t set = 1U; set < _setCount; ++set)
+    {
+        ListenerSet const& listenerSet = _sets[set];
+        if ((listenerSet._count == count)
+            && (0 == memcmp(&_pool[listenerSet._offset], indices, count)))
+        {
+            return static_cast<uint8_t>(set);
+        }
+    }
+    if ((_setCount >= MAX_LISTENER_SETS) || ((_poolUsed + count) > LISTENER_POOL_SIZE))
+    {
+        return NO_SET;
+    }
+    ListenerSet& listenerSet = _sets[_setCount];
+    listenerSet._offset      = static_cast<uint16_t>(_poolUsed);
+    listenerSet._count       = count;
+    memcpy(&_pool[_poolUsed], indices, count);
+    _poolUsed += count;
+    return static_cast<uint8_t>(_setCount++);
+}
+
+} // namespace bios
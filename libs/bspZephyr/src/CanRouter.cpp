@@ -0,0 +1,156 @@
+// Copyright 2025 Accenture.
+
+#include "can/gateway/CanRouter.h"
+
+#include "can/transceiver/ZephyrCanTransceiver.h"
+
+namespace bios
+{
+static_assert(CanRouter::MAX_ROUTES < 0xFFU, "route index has to fit into uint8_t");
+
+size_t const CanRouter::MAX_ROUTES;
+uint32_t const CanRouter::EXTENDED_ID_BITS;
+size_t const CanRouter::EXTENDED_ID_SLOTS;
+uint8_t const CanRouter::NO_ROUTE;
+uint32_t const CanRouter::NO_ID;
+
+CanRouter::CanRouter()
+: _standardIds(), _extendedIds(), _routes(), _routeCount(0U), _extendedIdCount(0U)
+{
+    _standardIds.fill(NO_ROUTE);
+    for (auto& slot : _extendedIds)
+    {
+        slot._id    = NO_ID;
+        slot._route = NO_ROUTE;
+    }
+}
+
+size_t CanRouter::hash(uint32_t const id)
+{
+    // Fibonacci hashing, the upper bits of the product are well mixed
+    return static_cast<size_t>((id * 2654435761U) >> (32U - EXTENDED_ID_BITS));
+}
+
+uint8_t CanRouter::findExtended(uint32_t const id) const
+{
+    size_t index = hash(id);
+    for (size_t i = 0U; i < EXTENDED_ID_SLOTS; ++i)
+    {
+        ExtendedIdSlot const& slot = _extendedIds[index];
+        if (slot._id == id)
+        {
+            return slot._route;
+        }
+        if (slot._id == NO_ID)
+        {
+            break;
+        }
+        index = (index + 1U) & (EXTENDED_ID_SLOTS - 1U);
+    }
+    return NO_ROUTE;
+}
+
+bool CanRouter::insertExtended(uint32_t const id, uint8_t const route)
+{
+    size_t index = hash(id);
+    for (size_t i = 0U; i < EXTENDED_ID_SLOTS; ++i)
+    {
+        ExtendedIdSlot& slot = _extendedIds[index];
+        if (slot._id == NO_ID)
+        {
+            slot._id    = id;
+            slot._route = route;
+            return true;
+        }
+        if (slot._id == id)
+        {
+            return false;
+        }
+        index = (index + 1U) & (EXTENDED_ID_SLOTS - 1U);
+    }
+    return false;
+}
+
+bool CanRouter::addRoute(
+    uint32_t const firstId,
+    uint32_t const lastId,
+    bool const extended,
+    ZephyrCanTransceiver& destination,
+    uint32_t const rewriteId,
+    uint32_t const rewriteMask)
+{
+    uint32_t const maxId = extended ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK;
+    // the hash table has to take all IDs of the range, so no insertion can fail below
+    if ((_routeCount >= MAX_ROUTES) || (firstId > lastId) || (lastId > maxId)
+        || (extended && ((lastId - firstId) >= (EXTENDED_ID_SLOTS - _extendedIdCount))))
+    {
+        return false;
+    }
+    uint8_t const index = static_cast<uint8_t>(_routeCount);
+    for (uint32_t id = firstId; id <= lastId; ++id)
+    {
+        if (extended ? (findExtended(id) != NO_ROUTE) : (_standardIds[id] != NO_ROUTE))
+        {
+            return false;
+        }
+    }
+    for (uint32_t id = firstId; id <= lastId; ++id)
+    {
+        if (!extended)
+        {
+            _standardIds[id] = index;
+        }
+        else
+        {
+            (void)insertExtended(id, index);
+            ++_extendedIdCount;
+        }
+    }
+
+    Route& route       = _routes[index];
+    route._destination = &destination;
+    route._rewriteMask = rewriteMask & maxId;
+    route._rewriteId   = rewriteId & route._rewriteMask;
+    route._firstId     = firstId;
+    route._lastId      = lastId;
+    route._extended    = extended;
+    route._forwarded   = 0U;
+    route._dropped     = 0U;
+    ++_routeCount;
+    return true;
+}
+
+bool CanRouter::route(struct can_frame const& frame)
+{
+    bool const extended = (frame.flags & CAN_FRAME_IDE) != 0U;
+    uint8_t const index = extended ? findExtended(frame.id) : _standardIds[frame.id & CAN_STD_ID_MASK];
+    if ((index == NO_ROUTE) || (index >= _routeCount))
+    {
+        return false;
+    }
+
+    Route& route = _routes[index];
+    bool sent;
+    if (0U == route._rewriteMask)
+    {
+        sent = route._destination->forward(frame);
+    }
+    else
+    {
+        // the frame of the driver is const, only the header changes
+        struct can_frame rewritten = frame;
+        rewritten.id               = (frame.id & ~route._rewriteMask) | route._rewriteId;
+        sent                       = route._destination->forward(rewritten);
+    }
+    if (sent)
+    {
+        ++route._forwarded;
+    }
+    else
+    {
+        ++route._dropped;
+    }
+    return true;
+}
+
+} // namespace bios
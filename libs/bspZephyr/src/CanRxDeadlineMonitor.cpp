@@ -0,0 +1,171 @@
+// Copyright 2025 Accenture.
+
+#include "can/monitor/CanRxDeadlineMonitor.h"
+
+#include "can/transceiver/ZephyrCanTransceiver.h"
+
+#include <can/canframes/CanId.h>
+
+#include <zephyr/kernel.h>
+
+namespace bios
+{
+size_t const CanRxDeadlineMonitor::MAX_LISTENERS;
+
+CanRxDeadlineMonitor::CanRxDeadlineMonitor(
+    ::etl::span<CanRxDeadline const> const deadlines,
+    ::etl::span<uint32_t> const ids,
+    ::etl::span<uint32_t> const lastSeenMs,
+    ::etl::span<Supervision> const supervisions,
+    uint16_t const sweepMs)
+: _deadlines(deadlines)
+, _ids(ids)
+, _lastSeenMs(lastSeenMs)
+, _supervisions(supervisions)
+, _size(deadlines.size())
+, _listeners()
+, _listenerCount(0U)
+, _transceiver(nullptr)
+, _timeout()
+, _sweepMs((sweepMs > 0U) ? sweepMs : 1U)
+{}
+
+bool CanRxDeadlineMonitor::addListener(ICanRxDeadlineListener& listener)
+{
+    if (_listenerCount >= MAX_LISTENERS)
+    {
+        return false;
+    }
+    _listeners[_listenerCount] = &listener;
+    ++_listenerCount;
+    return true;
+}
+
+void CanRxDeadlineMonitor::start(
+    ::async::ContextType const context, ZephyrCanTransceiver& transceiver)
+{
+    sort();
+    uint32_t const now = k_uptime_get_32();
+    for (size_t i = 0U; i < _size; ++i)
+    {
+        Supervision& supervision = _supervisions[i];
+        supervision._misses      = 0U;
+        supervision._missed      = false;
+        _lastSeenMs[i]           = now;
+    }
+    _transceiver = &transceiver;
+    transceiver.setRxDeadlineMonitor(this);
+    ::async::scheduleAtFixedRate(
+        context, *this, _timeout, _sweepMs, ::async::TimeUnit::MILLISECONDS);
+}
+
+void CanRxDeadlineMonitor::stop()
+{
+    _timeout.cancel();
+    if (_transceiver != nullptr)
+    {
+        _transceiver->setRxDeadlineMonitor(nullptr);
+    }
+}
+
+void CanRxDeadlineMonitor::sort()
+{
+    // insertion sort by ID, the tables are small and this is only done at start
+    for (size_t i = 0U; i < _size; ++i)
+    {
+        CanRxDeadline const& deadline = _deadlines[i];
+        size_t position               = i;
+        while ((position > 0U) && (_ids[position - 1U] > deadline._id))
+        {
+            _ids[position]          = _ids[position - 1U];
+            _supervisions[position] = _supervisions[position - 1U];
+            --position;
+        }
+        _ids[position]                     = deadline._id;
+        _supervisions[position]._timeoutMs = deadline._timeoutMs;
+        _supervisions[position]._index     = static_cast<uint16_t>(i);
+    }
+}
+
+void CanRxDeadlineMonitor::frameReceived(uint32_t const id, bool const extended)
+{
+    if (_size == 0U)
+    {
+        return;
+    }
+    uint32_t const key = ::can::CanId::id(id, extended);
+    // branch-free lower bound: index of the last ID at or below key
+    size_t base  = 0U;
+    size_t count = _size;
+    while (count > 1U)
+    {
+        size_t const half = count / 2U;
+        base              = (_ids[base + half] <= key) ? (base + half) : base;
+        count -= half;
+    }
+    if (_ids[base] == key)
+    {
+        _lastSeenMs[base] = k_uptime_get_32();
+    }
+}
+
+uint32_t CanRxDeadlineMonitor::getAgeMs(size_t const position) const
+{
+    return k_uptime_get_32() - _lastSeenMs[position];
+}
+
+void CanRxDeadlineMonitor::execute()
+{
+    uint32_t const now = k_uptime_get_32();
+    for (size_t i = 0U; i < _size; ++i)
+    {
+        Supervision& supervision = _supervisions[i];
+        uint32_t const lastSeen  = _lastSeenMs[i];
+        // negative if the frame was received after now has been taken
+        int32_t const age    = static_cast<int32_t>(now - lastSeen);
+        bool const isExpired = (age > static_cast<int32_t>(supervision._timeoutMs));
+        if (isExpired)
+        {
+            // Keep the timestamp just beyond the timeout so that it never gets old enough to
+            // look recent again after a wrap of the uptime counter. Not overwritten if the
+            // interrupt stored a new timestamp in the meantime.
+            {
+                ::async::LockType const lock;
+                if (_lastSeenMs[i] == lastSeen)
+                {
+                    _lastSeenMs[i] = now - supervision._timeoutMs - 1U;
+                }
+            }
+            if (!supervision._missed)
+            {
+                supervision._missed = true;
+                ++supervision._misses;
+                notify(i, true);
+            }
+        }
+        else if (supervision._missed)
+        {
+            supervision._missed = false;
+            notify(i, false);
+        }
+    }
+}
+
+void CanRxDeadlineMonitor::notify(size_t const position, bool const missed)
+{
+    size_t const index = _supervisions[position]._index;
+    uint32_t const id  = _ids[position];
+    for (size_t i = 0U; i < _listenerCount; ++i)
+    {
+        if (missed)
+        {
+            _listeners[i]->rxDeadlineMissed(index, id);
+        }
+        else
+        {
+            _listeners[i]->rxDeadlineRecovered(index, id);
+        }
+    }
+}
+
+} // namespace bios
@@ -0,0 +1,181 @@
+// Copyright 2025 Accenture.
+
+#include "can/scheduler/CanTxScheduler.h"
+
+#include "can/transceiver/ZephyrCanTransceiver.h"
+
+#include <bsp/timer/SystemTimer.h>
+
+namespace bios
+{
+uint16_t const CanTxScheduler::AUTO_OFFSET;
+size_t const CanTxScheduler::MAX_FRAMES_PER_BATCH;
+size_t const CanTxScheduler::STAGGER_HORIZON_TICKS;
+
+CanTxScheduler::CanTxScheduler(
+    ::etl::span<CanTxMessage const> const messages,
+    ::etl::span<MessageState> const states,
+    ICanTxPayloadProvider& provider,
+    uint16_t const tickMs)
+: _messages(messages)
+, _states(states)
+, _provider(provider)
+, _transceiver(nullptr)
+, _timeout()
+, _tickMs((tickMs > 0U) ? tickMs : 1U)
+, _tick(0U)
+, _startUs(0U)
+, _frames()
+, _frameMessages()
+{}
+
+void CanTxScheduler::start(::async::ContextType const context, ZephyrCanTransceiver& transceiver)
+{
+    _transceiver = &transceiver;
+    assignOffsets();
+    for (size_t i = 0U; i < _messages.size(); ++i)
+    {
+        MessageState& state   = _states[i];
+        state._nextTick       = state._offsetTicks;
+        state._sent           = 0U;
+        state._failed         = 0U;
+        state._minDeviationUs = INT32_MAX;
+        state._maxDeviationUs = INT32_MIN;
+    }
+    _tick = 0U;
+    // tick 0 is the first timeout, one tick after now
+    _startUs = getSystemTimeUs32Bit() + (static_cast<uint32_t>(_tickMs) * 1000U);
+    ::async::scheduleAtFixedRate(
+        context, *this, _timeout, _tickMs, ::async::TimeUnit::MILLISECONDS);
+}
+
+void CanTxScheduler::stop() { _timeout.cancel(); }
+
+void CanTxScheduler::assignOffsets()
+{
+    // number of messages due per tick within the horizon
+    uint8_t load[STAGGER_HORIZON_TICKS] = {};
+    // messages with fixed offset first, the others are fitted in between
+    for (bool const autoOffset : {false, true})
+    {
+        for (size_t i = 0U; i < _messages.size(); ++i)
+        {
+            CanTxMessage const& message = _messages[i];
+            if ((message._offsetMs == AUTO_OFFSET) != autoOffset)
+            {
+                continue;
+            }
+            MessageState& state = _states[i];
+            state._periodTicks  = message._periodMs / _tickMs;
+            if (state._periodTicks == 0U)
+            {
+                state._periodTicks = 1U;
+            }
+            state._offsetTicks = autoOffset ? findOffset(load, state._periodTicks)
+                                            : (message._offsetMs / _tickMs);
+            for (uint32_t tick = state._offsetTicks; tick < STAGGER_HORIZON_TICKS;
+                 tick += state._periodTicks)
+            {
+                if (load[tick] < UINT8_MAX)
+                {
+                    ++load[tick];
+                }
+            }
+        }
+    }
+}
+
+uint32_t CanTxScheduler::findOffset(uint8_t const load[], uint32_t const periodTicks)
+{
+    // the offset whose ticks have the lowest maximum load so far
+    uint32_t const candidates
+        = (periodTicks < STAGGER_HORIZON_TICKS) ? periodTicks : STAGGER_HORIZON_TICKS;
+    uint32_t bestOffset = 0U;
+    uint8_t bestLoad    = UINT8_MAX;
+    for (uint32_t offset = 0U; offset < candidates; ++offset)
+    {
+        uint8_t maxLoad = 0U;
+        for (uint32_t tick = offset; tick < STAGGER_HORIZON_TICKS; tick += periodTicks)
+        {
+            maxLoad = (load[tick] > maxLoad) ? load[tick] : maxLoad;
+        }
+        if (maxLoad < bestLoad)
+        {
+            bestLoad   = maxLoad;
+            bestOffset = offset;
+        }
+    }
+    return bestOffset;
+}
+
+void CanTxScheduler::execute()
+{
+    uint32_t const tick  = _tick;
+    uint32_t const nowUs = getSystemTimeUs32Bit();
+    ++_tick;
+
+    size_t count = 0U;
+    for (size_t i = 0U; i < _messages.size(); ++i)
+    {
+        MessageState& state = _states[i];
+        if (static_cast<int32_t>(tick - state._nextTick) < 0)
+        {
+            continue;
+        }
+        uint32_t const idealUs
+            = _startUs + (state._nextTick * static_cast<uint32_t>(_tickMs) * 1000U);
+        int32_t const deviationUs = static_cast<int32_t>(nowUs - idealUs);
+        if (deviationUs < state._minDeviationUs)
+        {
+            state._minDeviationUs = deviationUs;
+        }
+        if (deviationUs > state._maxDeviationUs)
+        {
+            state._maxDeviationUs = deviationUs;
+        }
+        // skipped ticks are not caught up, the phase is kept
+        while (static_cast<int32_t>(tick - state._nextTick) >= 0)
+        {
+            state._nextTick += state._periodTicks;
+        }
+
+        CanTxMessage const& message = _messages[i];
+        ::can::CANFrame& frame      = _frames[count];
+        frame.setId(message._id);
+        frame.setPayloadLength(message._length);
+        _provider.fillPayload(i, frame);
+        _frameMessages[count] = i;
+        ++count;
+        if (count == MAX_FRAMES_PER_BATCH)
+        {
+            send(count);
+            count = 0U;
+        }
+    }
+    if (count > 0U)
+    {
+        send(count);
+    }
+}
+
+void CanTxScheduler::send(size_t const count)
+{
+    ::can::ICanTransceiver::ErrorCode results[MAX_FRAMES_PER_BATCH];
+    (void)_transceiver->write(
+        ::etl::span<::can::CANFrame const>(_frames.data(), count),
+        ::etl::span<::can::ICanTransceiver::ErrorCode>(results, count));
+    for (size_t i = 0U; i < count; ++i)
+    {
+        MessageState& state = _states[_frameMessages[i]];
+        if (::can::ICanTransceiver::ErrorCode::CAN_ERR_OK == results[i])
+        {
+            ++state._sent;
+        }
+        else
+        {
+            ++state._failed;
+        }
+    }
+}
+
+} // namespace bios
@@ -0,0 +1,124 @@
+// Copyright 2025 Accenture.
+
+#include "can/filter/ExtendedIdFilter.h"
+
+namespace
+{
+uint32_t const MAX_EXTENDED_ID = 0x1FFFFFFFU;
+
+// J1939 ID: priority (3), EDP (1), DP (1), PDU format (8), PDU specific (8), source address (8)
+uint32_t const J1939_PGN_SHIFT       = 8U;
+uint32_t const J1939_PDU2_MASK       = 0x03FFFF00U;
+// PDU1 format (PF < 240): the PDU specific field is the destination address
+uint32_t const J1939_PDU1_MASK       = 0x03FF0000U;
+uint32_t const J1939_PDU2_MIN_FORMAT = 240U;
+} // namespace
+
+namespace bios
+{
+size_t const ExtendedIdFilter::MAX_RANGES;
+size_t const ExtendedIdFilter::MAX_MASKS;
+
+ExtendedIdFilter::ExtendedIdFilter()
+: _firstIds(), _lastIds(), _maskValues(), _masks(), _rangeCount(0U), _maskCount(0U), _open(false)
+{}
+
+bool ExtendedIdFilter::addRange(uint32_t firstId, uint32_t lastId)
+{
+    if ((firstId > lastId) || (lastId > MAX_EXTENDED_ID))
+    {
+        return false;
+    }
+    // merge all ranges overlapping or adjacent to the new one
+    size_t insert = 0U;
+    while ((insert < _rangeCount) && (_lastIds[insert] < firstId)
+           && ((_lastIds[insert] + 1U) != firstId))
+    {
+        ++insert;
+    }
+    size_t end = insert;
+    while ((end < _rangeCount) && ((lastId == MAX_EXTENDED_ID) || (_firstIds[end] <= (lastId + 1U))))
+    {
+        firstId = (_firstIds[end] < firstId) ? _firstIds[end] : firstId;
+        lastId  = (_lastIds[end] > lastId) ? _lastIds[end] : lastId;
+        ++end;
+    }
+    size_t const newCount = (_rangeCount - (end - insert)) + 1U;
+    if (newCount > MAX_RANGES)
+    {
+        return false;
+    }
+    if (end == insert)
+    {
+        // nothing merged, make room
+        for (size_t i = _rangeCount; i > insert; --i)
+        {
+            _firstIds[i] = _firstIds[i - 1U];
+            _lastIds[i]  = _lastIds[i - 1U];
+        }
+    }
+    else
+    {
+        // ranges insert..end-1 are replaced by one
+        for (size_t i = end; i < _rangeCount; ++i)
+        {
+            _firstIds[insert + 1U + (i - end)] = _firstIds[i];
+            _lastIds[insert + 1U + (i - end)]  = _lastIds[i];
+        }
+    }
+    _firstIds[insert] = firstId;
+    _lastIds[insert]  = lastId;
+    _rangeCount       = newCount;
+    return true;
+}
+
+bool ExtendedIdFilter::addMask(uint32_t const value, uint32_t const mask)
+{
+    if (_maskCount >= MAX_MASKS)
+    {
+        return false;
+    }
+    _masks[_maskCount]      = mask & MAX_EXTENDED_ID;
+    _maskValues[_maskCount] = value & _masks[_maskCount];
+    ++_maskCount;
+    return true;
+}
+
+bool ExtendedIdFilter::addPgn(uint32_t const pgn)
+{
+    uint32_t const pduFormat = (pgn >> 8U) & 0xFFU;
+    uint32_t const mask = (pduFormat < J1939_PDU2_MIN_FORMAT) ? J1939_PDU1_MASK : J1939_PDU2_MASK;
+    return addMask(pgn << J1939_PGN_SHIFT, mask);
+}
+
+void ExtendedIdFilter::open() { _open = true; }
+
+void ExtendedIdFilter::clear()
+{
+    _rangeCount = 0U;
+    _maskCount  = 0U;
+    _open       = false;
+}
+
+bool ExtendedIdFilter::match(uint32_t const id) const
+{
+    // branch-free lower bound: index of the last range starting at or below id
+    size_t base  = 0U;
+    size_t count = _rangeCount;
+    while (count > 1U)
+    {
+        size_t const half = count / 2U;
+        base              = (_firstIds[base + half] <= id) ? (base + half) : base;
+        count -= half;
+    }
+    // the range at index 0 is valid memory even for an empty table
+    bool accepted
+        = _open | ((_rangeCount > 0U) & (_firstIds[base] <= id) & (id <= _lastIds[base]));
+    for (size_t i = 0U; i < _maskCount; ++i)
+    {
+        accepted |= ((id & _masks[i]) == _maskValues[i]);
+    }
+    return accepted;
+}
+
+} // namespace bios
@@ -25,6 +25,14 @@ uint32_t getSystemTicks32Bit(void)
     return k_cycle_get_32();
 }
 
+uint32_t systemTicks32BitToTimeUs32Bit(uint32_t ticks)
+{
+    uint64_t const now = k_cycle_get_64();
+    // extend the ticks to 64 bit by their distance to now
+    uint32_t const age = static_cast<uint32_t>(now) - ticks;
+    return k_cyc_to_us_floor32(now - age);
+}
+
 uint64_t systemTicksToTimeNs(uint64_t ticks)
 {
     return k_cyc_to_ns_floor64(ticks);
@@ -2,6 +2,9 @@
 
 #include "can/transceiver/ZephyrCanTransceiver.h"
 
+#include "can/gateway/CanRouter.h"
+#include "can/monitor/CanRxDeadlineMonitor.h"
+
 #include <async/Types.h>
 #include <can/CanLogger.h>
 #include <can/framemgmt/IFilteredCANFrameSentListener.h>
@@ -13,9 +16,57 @@
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/can.h>
+#include <zephyr/kernel.h>
+
+#ifdef PLATFORM_SUPPORT_CAPTURE
+#include <capture/Capture.h>
+#endif
 
 namespace logger = ::util::logger;
 
+namespace
+{
+uint8_t payloadLength(struct can_frame const& frame)
+{
+    if ((frame.flags & CAN_FRAME_FDF) != 0U)
+    {
+        return can_dlc_to_bytes(frame.dlc);
+    }
+    // DLC values 9..15 of classic frames still carry 8 bytes
+    return (frame.dlc > CAN_MAX_DLC) ? CAN_MAX_DLC : frame.dlc;
+}
+
+#ifdef PLATFORM_SUPPORT_CAPTURE
+void captureFrame(::capture::RecordType const type, uint8_t const busId, struct can_frame const& frame)
+{
+    uint8_t flags = 0U;
+    if ((frame.flags & CAN_FRAME_IDE) != 0U)
+    {
+        flags |= ::capture::CAN_FLAG_EXTENDED;
+    }
+    if ((frame.flags & CAN_FRAME_FDF) != 0U)
+    {
+        flags |= ::capture::CAN_FLAG_FD;
+    }
+    if ((frame.flags & CAN_FRAME_BRS) != 0U)
+    {
+        flags |= ::capture::CAN_FLAG_BRS;
+    }
+    ::capture::captureCanFrame(type, busId, frame.id, flags, frame.data, payloadLength(frame));
+}
+#endif
+
+// frame lengths in bits without data field and stuff bits:
+// SOF, arbitration field, control field, CRC field, ACK field, EOF and IFS
+uint32_t const CLASSIC_STD_OVERHEAD_BITS = 47U;
+uint32_t const CLASSIC_EXT_OVERHEAD_BITS = 67U;
+// FD frames: arbitration phase up to BRS and ACK/EOF/IFS at nominal bit rate ...
+uint32_t const FD_STD_NOMINAL_BITS       = 17U + 12U;
+uint32_t const FD_EXT_NOMINAL_BITS       = 36U + 12U;
+// ... ESI, DLC, stuff count and CRC delimiter at data bit rate, plus CRC17/CRC21
+uint32_t const FD_DATA_OVERHEAD_BITS     = 10U;
+} // namespace
+
 namespace bios
 {
 
@@ -24,24 +75,65 @@ ZephyrCanTransceiver::ZephyrCanTransceiver(
     uint8_t const busId,
     const struct device *const canDevice,
     uint32_t baudRate)
+: ZephyrCanTransceiver(context, busId, canDevice, baudRate, FrameFormat::CLASSIC, 0U)
+{}
+
+ZephyrCanTransceiver::ZephyrCanTransceiver(
+    ::async::ContextType context,
+    uint8_t const busId,
+    const struct device *const canDevice,
+    uint32_t baudRate,
+    FrameFormat const format,
+    uint32_t dataBaudRate)
 : AbstractCANTransceiver(busId)
 , _canDevice(canDevice)
 , _baudRate(baudRate)
+, _dataBaudRate(dataBaudRate)
+, _format(format)
 , _rxQueue()
+, _dispatcher()
 , _rxFilterId(0)
+, _rxExtendedFilterId(-1)
+, _extendedIdFilter()
 , _txOfflineErrors(0)
 , _overrunCount(0)
 , _framesSentCount(0)
 , _txQueue()
+, _txBatchQueue()
+, _txSlots()
+, _txSlotsUsed(0U)
+, _txFramesInDriver(0U)
+, _txTimestampTicks(0U)
+, _statistics()
 , _context(context)
-, _cyclicTask(
-      ::async::Function::CallType::create<ZephyrCanTransceiver, &ZephyrCanTransceiver::cyclicTask>(
+, _stateChangeTask(
+      ::async::Function::CallType::create<ZephyrCanTransceiver, &ZephyrCanTransceiver::stateChangeTask>(
           *this))
 , _receiveTask(
       ::async::Function::CallType::create<ZephyrCanTransceiver, &ZephyrCanTransceiver::receiveTask>(
           *this))
-, _cyclicTaskTimeout()
-{}
+, _recoveryTask(
+      ::async::Function::CallType::create<ZephyrCanTransceiver, &ZephyrCanTransceiver::recoveryTask>(
+          *this))
+, _recoveryTimeout()
+, _canState(CAN_STATE_STOPPED)
+, _busOffRecovery(BusOffRecovery::AUTOMATIC)
+, _recoveryBackoffMs()
+, _recoveryAttempt(0U)
+, _router(nullptr)
+, _rxDeadlineMonitor(nullptr)
+, _fastPathHandlers()
+, _fastPathHandlerCount(0U)
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+, _rxTimestampSync()
+#endif
+{
+    for (auto& slot : _txSlots)
+    {
+        slot._transceiver = this;
+    }
+    _extendedIdFilter.open();
+}
 
 ::can::ICanTransceiver::ErrorCode ZephyrCanTransceiver::init()
 {
@@ -56,7 +148,42 @@ ZephyrCanTransceiver::ZephyrCanTransceiver(
             return ErrorCode::CAN_ERR_INIT_FAILED;
         }
 
-        if (0 != can_set_mode(_canDevice, CAN_MODE_NORMAL))
+        can_mode_t mode = CAN_MODE_NORMAL;
+        if (FrameFormat::FD == _format)
+        {
+#ifdef CONFIG_CAN_FD_MODE
+            if ((0U != _dataBaudRate) && (0 != can_set_bitrate_data(_canDevice, _dataBaudRate)))
+            {
+                logger::Logger::error(
+                    logger::CAN,
+                    "Could not set data bitrate %d for %s",
+                    _dataBaudRate,
+                    ::common::busid::BusIdTraits::getName(_busId));
+                return ErrorCode::CAN_ERR_INIT_FAILED;
+            }
+            mode |= CAN_MODE_FD;
+#else
+            logger::Logger::error(
+                logger::CAN,
+                "CAN FD requested but CONFIG_CAN_FD_MODE disabled for %s",
+                ::common::busid::BusIdTraits::getName(_busId));
+            return ErrorCode::CAN_ERR_INIT_FAILED;
+#endif
+        }
+        if (BusOffRecovery::MANUAL == _busOffRecovery)
+        {
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+            mode |= CAN_MODE_MANUAL_RECOVERY;
+#else
+            logger::Logger::error(
+                logger::CAN,
+                "Manual recovery requested but CONFIG_CAN_MANUAL_RECOVERY_MODE disabled for %s",
+                ::common::busid::BusIdTraits::getName(_busId));
+            return ErrorCode::CAN_ERR_INIT_FAILED;
+#endif
+        }
+
+        if (0 != can_set_mode(_canDevice, mode))
         {
             logger::Logger::error(
                 logger::CAN,
@@ -83,16 +210,132 @@ ZephyrCanTransceiver::write(::can::CANFrame const& frame, ::can::ICANFrameSentLi
     return write(frame, &listener);
 }
 
-void ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame const& frame)
+size_t ZephyrCanTransceiver::write(
+    ::etl::span<::can::CANFrame const> const frames, ::etl::span<ErrorCode> const results)
+{
+    ErrorCode stateError = ErrorCode::CAN_ERR_OK;
+    if (State::MUTED == _state)
+    {
+        stateError = ErrorCode::CAN_ERR_ILLEGAL_STATE;
+    }
+    else if (State::CLOSED == _state)
+    {
+        _txOfflineErrors += static_cast<uint16_t>(frames.size());
+        stateError = ErrorCode::CAN_ERR_TX_OFFLINE;
+    }
+    if (ErrorCode::CAN_ERR_OK != stateError)
+    {
+        for (size_t i = 0U; (i < frames.size()) && (i < results.size()); ++i)
+        {
+            results[i] = stateError;
+        }
+        return 0U;
+    }
+
+    size_t accepted = 0U;
+    {
+        async::LockType const lock;
+        for (size_t i = 0U; i < frames.size(); ++i)
+        {
+            ErrorCode const result = writeOrQueue(frames[i]);
+            if (ErrorCode::CAN_ERR_OK == result)
+            {
+                ++accepted;
+            }
+            if (i < results.size())
+            {
+                results[i] = result;
+            }
+        }
+    }
+    for (auto const& frame : frames)
+    {
+        notifyRegisteredSentListener(frame);
+    }
+    return accepted;
+}
+
+::can::ICanTransceiver::ErrorCode ZephyrCanTransceiver::writeOrQueue(::can::CANFrame const& frame)
 {
+    can_frame canFrame;
+    if (!buildCanFrame(canFrame, frame))
+    {
+        return ErrorCode::CAN_ERR_TX_FAIL;
+    }
+    // frames of a previous batch are still waiting, keep the order
+    if (_txBatchQueue.empty())
+    {
+        int const result = sendFrame(canFrame);
+        if (0 == result)
+        {
+            return ErrorCode::CAN_ERR_OK;
+        }
+        if (-EAGAIN != result)
+        {
+            return ErrorCode::CAN_ERR_TX_FAIL;
+        }
+    }
+    if (_txBatchQueue.full())
+    {
+        _overrunCount++;
+        return ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL;
+    }
+    _txBatchQueue.push(canFrame);
+    updateTxQueueHighWater();
+    return ErrorCode::CAN_ERR_OK;
+}
+
+void ZephyrCanTransceiver::sendBatchQueue()
+{
+    while (!_txBatchQueue.empty())
+    {
+        int const result = sendFrame(_txBatchQueue.front());
+        if (-EAGAIN == result)
+        {
+            // retried with the next TX complete interrupt
+            return;
+        }
+        if (0 != result)
+        {
+            ++_statistics._txErrors;
+        }
+        _txBatchQueue.pop();
+    }
+}
+
+bool ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame const& frame) const
+{
+    uint8_t const length = frame.getPayloadLength();
+
     canFrame.id = can::CanId::rawId(frame.getId());
     canFrame.flags = 0;
     if (can::CanId::isExtended(frame.getId()))
     {
         canFrame.flags |= CAN_FRAME_IDE;
     }
-    canFrame.dlc = frame.getPayloadLength();
-    memcpy(canFrame.data, frame.getPayload(), frame.getPayloadLength());
+#ifdef CONFIG_CAN_FD_MODE
+    if (FrameFormat::FD == _format)
+    {
+        if (length > CANFD_MAX_DLEN)
+        {
+            return false;
+        }
+        canFrame.flags |= (CAN_FRAME_FDF | CAN_FRAME_BRS);
+        // rounds up to the next valid FD length, the gap is padded below
+        canFrame.dlc = can_bytes_to_dlc(length);
+        uint8_t const frameLength = can_dlc_to_bytes(canFrame.dlc);
+        memcpy(canFrame.data, frame.getPayload(), length);
+        memset(&canFrame.data[length], 0, frameLength - length);
+        return true;
+    }
+#endif
+    if (length > CAN_MAX_DLC)
+    {
+        return false;
+    }
+    canFrame.dlc = length;
+    memcpy(canFrame.data, frame.getPayload(), length);
+    return true;
 }
 
 ::can::ICanTransceiver::ErrorCode ZephyrCanTransceiver::write(
@@ -118,14 +361,23 @@ void ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame co
         return ErrorCode::CAN_ERR_TX_OFFLINE;
     }
 
-    buildCanFrame(canFrame, frame);
+    if (!buildCanFrame(canFrame, frame))
+    {
+        logger::Logger::warn(
+            logger::CAN,
+            "Write Id 0x%x with invalid length %d to %s",
+            frame.getId(),
+            frame.getPayloadLength(),
+            ::common::busid::BusIdTraits::getName(_busId));
+        return ErrorCode::CAN_ERR_TX_FAIL;
+    }
 
     async::ModifiableLockType mlock;
     if (pListener == nullptr)
     {
-        // supply callback to prevent blocking wait, NULL user data tells the callback to ignore
-        result = can_send(_canDevice, &canFrame, K_NO_WAIT, ZephyrCanTransceiver::transmitCallback, NULL);
-        
+        // supply callback to prevent blocking wait
+        result = sendFrame(canFrame);
+
         if (-EAGAIN == result)
         {
             // timeout waiting for TX buffer
@@ -138,7 +390,6 @@ void ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame co
         if (0 == result)
         {
             // success
-            _framesSentCount++;
             mlock.unlock();
             notifyRegisteredSentListener(frame);
             return ErrorCode::CAN_ERR_OK;
@@ -159,6 +410,7 @@ void ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame co
     }
     bool const wasEmpty = _txQueue.empty();
     _txQueue.emplace_back(*pListener, frame);
+    updateTxQueueHighWater();
     if (!wasEmpty)
     {
         // nothing to do next frame will be sent from tx isr
@@ -167,7 +419,13 @@ void ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame co
     ErrorCode status;
     // we are the first sender --> transmit
 
-    result = can_send(_canDevice, &canFrame, K_NO_WAIT, ZephyrCanTransceiver::transmitCallback, this);
+    TxSlot* const pSlot = acquireTxSlot(canFrame);
+    result = (pSlot == nullptr) ? -EAGAIN
+             : can_send(_canDevice, &canFrame, K_NO_WAIT, ZephyrCanTransceiver::transmitCallback, pSlot);
+    if ((0 != result) && (pSlot != nullptr))
+    {
+        releaseTxSlot(*pSlot);
+    }
     if (-EAGAIN == result)
     {
         status = ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL;
@@ -178,6 +436,9 @@ void ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame co
     }
     else
     {
+#ifdef PLATFORM_SUPPORT_CAPTURE
+        captureFrame(::capture::RecordType::CAN_TX, _busId, canFrame);
+#endif
         // wait until tx interrupt ...
         // ... then canFrameSentCallback() is called
         return ErrorCode::CAN_ERR_OK;
@@ -188,9 +449,169 @@ void ZephyrCanTransceiver::buildCanFrame(can_frame& canFrame, ::can::CANFrame co
     return status;
 }
 
-void ZephyrCanTransceiver::canFrameSentCallback(int /*error*/)
+bool ZephyrCanTransceiver::forward(struct can_frame const& frame)
+{
+    if ((State::OPEN != _state)
+        || ((FrameFormat::CLASSIC == _format) && ((frame.flags & CAN_FRAME_FDF) != 0U)))
+    {
+        return false;
+    }
+
+    async::LockType const lock;
+    if (0 != sendFrame(frame))
+    {
+        _overrunCount++;
+        return false;
+    }
+    return true;
+}
+
+int ZephyrCanTransceiver::sendFrame(struct can_frame const& canFrame)
+{
+    int const result = can_send(
+        _canDevice, &canFrame, K_NO_WAIT, ZephyrCanTransceiver::transmitDoneCallback, this);
+    if (0 == result)
+    {
+#ifdef PLATFORM_SUPPORT_CAPTURE
+        captureFrame(::capture::RecordType::CAN_TX, _busId, canFrame);
+#endif
+        // estimated here, the TX complete interrupt only counts the frame
+        _statistics._txBitTimes += getFrameBitTimes(canFrame);
+        ++_txFramesInDriver;
+        _framesSentCount++;
+        updateTxQueueHighWater();
+    }
+    return result;
+}
+
+ZephyrCanTransceiver::TxSlot*
+ZephyrCanTransceiver::acquireTxSlot(struct can_frame const& canFrame)
+{
+    for (auto& slot : _txSlots)
+    {
+        if (!slot._used)
+        {
+            slot._used       = true;
+            slot._writeTicks = getSystemTicks32Bit();
+            slot._bitTimes   = getFrameBitTimes(canFrame);
+            ++_txSlotsUsed;
+            updateTxQueueHighWater();
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void ZephyrCanTransceiver::releaseTxSlot(TxSlot& slot)
+{
+    slot._used = false;
+    --_txSlotsUsed;
+}
+
+void ZephyrCanTransceiver::updateTxQueueHighWater()
+{
+    // the front job of the TX queue already occupies a slot
+    size_t const queued
+        = (_txQueue.empty() ? 0U : (_txQueue.size() - 1U)) + _txBatchQueue.size();
+    size_t const depth  = _txSlotsUsed + _txFramesInDriver + queued;
+    if (depth > _statistics._txQueueHighWater)
+    {
+        _statistics._txQueueHighWater = static_cast<uint8_t>(depth);
+    }
+}
+
+uint32_t ZephyrCanTransceiver::getFrameBitTimes(struct can_frame const& frame) const
+{
+    bool const extended     = (frame.flags & CAN_FRAME_IDE) != 0U;
+    uint32_t const dataBits = payloadLength(frame) * 8U;
+    if ((frame.flags & CAN_FRAME_FDF) == 0U)
+    {
+        return (extended ? CLASSIC_EXT_OVERHEAD_BITS : CLASSIC_STD_OVERHEAD_BITS) + dataBits;
+    }
+    uint32_t const crcBits   = (dataBits > (16U * 8U)) ? 21U : 17U;
+    uint32_t const phaseBits = FD_DATA_OVERHEAD_BITS + crcBits + dataBits;
+    uint32_t const nominal   = extended ? FD_EXT_NOMINAL_BITS : FD_STD_NOMINAL_BITS;
+    if ((frame.flags & CAN_FRAME_BRS) == 0U)
+    {
+        return nominal + phaseBits;
+    }
+    // data phase bits scaled to nominal bit times
+    return nominal + ((phaseBits * _baudRate) / getDataBaudrate());
+}
+
+uint32_t const ZephyrCanTransceiver::TX_LATENCY_BUCKET_LIMITS_US[TX_LATENCY_BUCKET_COUNT]
+    = {100U, 200U, 500U, 1000U, 2000U, 5000U, 10000U, UINT32_MAX};
+
+uint32_t ZephyrCanTransceiver::getTxLatencyBucketLimitUs(size_t const bucket)
+{
+    return (bucket < TX_LATENCY_BUCKET_COUNT) ? TX_LATENCY_BUCKET_LIMITS_US[bucket] : UINT32_MAX;
+}
+
+void ZephyrCanTransceiver::getStatistics(Statistics& statistics) const
+{
+    async::LockType const lock;
+    statistics             = _statistics;
+    statistics._txOverruns = _overrunCount;
+}
+
+bool ZephyrCanTransceiver::getErrorCounters(can_state& state, can_bus_err_cnt& errCnt) const
+{
+    return 0 == can_get_state(_canDevice, &state, &errCnt);
+}
+
+uint32_t ZephyrCanTransceiver::getTxTimestamp() const
+{
+    return systemTicks32BitToTimeUs32Bit(_txTimestampTicks);
+}
+
+void ZephyrCanTransceiver::canFrameDoneCallback(int const error)
+{
+    async::LockType const lock;
+    --_txFramesInDriver;
+    if (0 == error)
+    {
+        ++_statistics._txFrames;
+    }
+    else
+    {
+        ++_statistics._txErrors;
+    }
+    if ((State::OPEN == _state) || (State::INITIALIZED == _state))
+    {
+        sendBatchQueue();
+    }
+}
+
+void ZephyrCanTransceiver::canFrameSentCallback(TxSlot& slot, int const error)
 {
     async::ModifiableLockType mlock;
+    slot._completeTicks = getSystemTicks32Bit();
+    // copied before the listener is notified without the lock, only one job is in the driver
+    _txTimestampTicks = slot._completeTicks;
+    if (0 == error)
+    {
+        uint32_t const latencyUs
+            = static_cast<uint32_t>(systemTicksToTimeUs(slot._completeTicks - slot._writeTicks));
+        size_t bucket = 0U;
+        while (latencyUs >= TX_LATENCY_BUCKET_LIMITS_US[bucket])
+        {
+            ++bucket;
+        }
+        ++_statistics._txLatency[bucket];
+        ++_statistics._txFrames;
+        _statistics._txBitTimes += slot._bitTimes;
+    }
+    else
+    {
+        ++_statistics._txErrors;
+    }
+    releaseTxSlot(slot);
+    // the next job with sent listener goes first, batch frames follow with its TX complete
+    bool const jobPending = _txQueue.size() > 1U;
+    if ((!jobPending) && ((State::OPEN == _state) || (State::INITIALIZED == _state)))
+    {
+        sendBatchQueue();
+    }
     _framesSentCount++;
     if (!_txQueue.empty())
     {
@@ -223,13 +644,22 @@ void ZephyrCanTransceiver::canFrameSentCallback(int /*error*/)
             mlock.lock();
             ::can::CANFrame const& frame = _txQueue.front()._frame;
 
-            buildCanFrame(canFrame, frame);
-            if (0 == can_send(_canDevice, &canFrame, K_NO_WAIT, ZephyrCanTransceiver::transmitCallback, this))
+            TxSlot* const pSlot
+                = buildCanFrame(canFrame, frame) ? acquireTxSlot(canFrame) : nullptr;
+            if ((pSlot != nullptr)
+                && (0 == can_send(_canDevice, &canFrame, K_NO_WAIT, ZephyrCanTransceiver::transmitCallback, pSlot)))
             {
+#ifdef PLATFORM_SUPPORT_CAPTURE
+                captureFrame(::capture::RecordType::CAN_TX, _busId, canFrame);
+#endif
                 // wait until tx interrupt ...
                 // ... then canFrameSentCallback() is called
                 return;
             }
+            if (pSlot != nullptr)
+            {
+                releaseTxSlot(*pSlot);
+            }
             // no interrupt will ever retrigger this call => remove all queued frames
             _txQueue.clear();
             mlock.unlock();
@@ -243,8 +673,22 @@ uint32_t ZephyrCanTransceiver::getBaudrate() const
     return _baudRate;
 }
 
+uint32_t ZephyrCanTransceiver::getDataBaudrate() const
+{
+    return ((FrameFormat::FD == _format) && (0U != _dataBaudRate)) ? _dataBaudRate : _baudRate;
+}
+
 uint16_t ZephyrCanTransceiver::getHwQueueTimeout() const
 {
+    if (FrameFormat::FD == _format)
+    {
+        // 29 = arbitration phase (extended ID) at nominal bit rate
+        // 512 = 64 byte payload
+        // 50 = control field, CRC (incl. stuff count) and ACK at data bit rate
+        auto const timeout
+            = (29U * 1000U / _baudRate) + ((50U + 512U) * 1000U / getDataBaudrate());
+        return static_cast<uint16_t>(timeout);
+    }
     // 64 = 8 byte payload
     // 53 = CAN overhead
     auto const timeout = ((53U + 64U) * 1000U / _baudRate);
@@ -272,6 +716,8 @@ void ZephyrCanTransceiver::resetFirstFrame()
 }
 
 can_filter const ZephyrCanTransceiver::MatchAllCanFilter = {.id=0, .mask=0, .flags=0};
+can_filter const ZephyrCanTransceiver::MatchAllExtendedCanFilter
+    = {.id=0, .mask=0, .flags=CAN_FILTER_IDE};
 
 ::can::ICanTransceiver::ErrorCode ZephyrCanTransceiver::open()
 {
@@ -286,17 +732,29 @@ can_filter const ZephyrCanTransceiver::MatchAllCanFilter = {.id=0, .mask=0, .fla
                 ::common::busid::BusIdTraits::getName(_busId));
             return ErrorCode::CAN_ERR_INIT_FAILED;
         }
+        // a filter without CAN_FILTER_IDE only matches standard frames
+        _rxExtendedFilterId = can_add_rx_filter(
+            _canDevice, ZephyrCanTransceiver::receiveCallback, this, &MatchAllExtendedCanFilter);
+        if (_rxExtendedFilterId < 0)
+        {
+            logger::Logger::warn(
+                logger::CAN,
+                "Can not add rx filter for extended frames for %s",
+                ::common::busid::BusIdTraits::getName(_busId));
+        }
+
+        can_set_state_change_callback(_canDevice, ZephyrCanTransceiver::stateChangeCallback, this);
 
         if (0 == can_start(_canDevice))
         {
             _state = State::OPEN;
 
-            ::async::scheduleAtFixedRate(
-                _context,
-                _cyclicTask,
-                _cyclicTaskTimeout,
-                ERROR_POLLING_TIMEOUT,
-                ::async::TimeUnitType::MILLISECONDS);
+            // state changes are reported by the driver from now on, report the initial one
+            can_state canState;
+            if (0 == can_get_state(_canDevice, &canState, nullptr))
+            {
+                canStateChangedCallback(canState);
+            }
 
             logger::Logger::debug(logger::CAN, "open()");
 
@@ -331,13 +789,20 @@ can_filter const ZephyrCanTransceiver::MatchAllCanFilter = {.id=0, .mask=0, .fla
         }
 
         can_remove_rx_filter(_canDevice, _rxFilterId);
+        if (_rxExtendedFilterId >= 0)
+        {
+            can_remove_rx_filter(_canDevice, _rxExtendedFilterId);
+            _rxExtendedFilterId = -1;
+        }
+        can_set_state_change_callback(_canDevice, nullptr, nullptr);
 
-        _cyclicTaskTimeout.cancel();
+        _recoveryTimeout.cancel();
 
         _state = State::CLOSED;
         {
             async::LockType const lock;
             _txQueue.clear();
+            _txBatchQueue.clear();
         }
         return ErrorCode::CAN_ERR_OK;
     }
@@ -350,11 +815,56 @@ can_filter const ZephyrCanTransceiver::MatchAllCanFilter = {.id=0, .mask=0, .fla
 void ZephyrCanTransceiver::shutdown()
 {
     (void)close();
-    _cyclicTaskTimeout.cancel();
+    _recoveryTimeout.cancel();
 
     // Do not invoke receiveTask after shutdown!
 }
 
+void ZephyrCanTransceiver::setExtendedIdFilter(ExtendedIdFilter const& filter)
+{
+    async::LockType const lock;
+    _extendedIdFilter = filter;
+}
+
+bool ZephyrCanTransceiver::addFastPathHandler(
+    uint32_t const id, bool const extended, ICanFastPathHandler& handler, uint32_t const budgetUs)
+{
+    async::LockType const lock;
+    if (_fastPathHandlerCount >= MAX_FAST_PATH_HANDLERS)
+    {
+        return false;
+    }
+    FastPathHandler& entry = _fastPathHandlers[_fastPathHandlerCount];
+    entry._handler         = &handler;
+    entry._id              = id;
+    entry._extended        = extended;
+    entry._enabled         = true;
+    entry._overruns        = 0U;
+    entry._budgetCycles    = k_us_to_cyc_ceil32(budgetUs);
+    entry._calls           = 0U;
+    entry._maxCycles       = 0U;
+    ++_fastPathHandlerCount;
+    return true;
+}
+
+void ZephyrCanTransceiver::addCANFrameListener(::can::ICANFrameListener& listener)
+{
+    AbstractCANTransceiver::addCANFrameListener(listener);
+    _dispatcher.addListener(listener, false);
+}
+
+void ZephyrCanTransceiver::addVIPCANFrameListener(::can::ICANFrameListener& listener)
+{
+    AbstractCANTransceiver::addVIPCANFrameListener(listener);
+    _dispatcher.addListener(listener, true);
+}
+
+void ZephyrCanTransceiver::removeCANFrameListener(::can::ICANFrameListener& listener)
+{
+    AbstractCANTransceiver::removeCANFrameListener(listener);
+    _dispatcher.removeListener(listener);
+}
+
 ::can::ICanTransceiver::ErrorCode ZephyrCanTransceiver::mute()
 {
     if (State::OPEN == _state)
@@ -362,6 +872,7 @@ void ZephyrCanTransceiver::shutdown()
         {
             async::LockType const lock;
             _txQueue.clear();
+            _txBatchQueue.clear();
         }
         _state = State::MUTED;
         return ErrorCode::CAN_ERR_OK;
@@ -391,52 +902,161 @@ void ZephyrCanTransceiver::receiveTask()
 
     while (false == _rxQueue.empty())
     {
-        ::can::CANFrame& frame = _rxQueue.front();
+        RxFrame& rxFrame = _rxQueue.front();
         mlock.unlock();
-        notifyListeners(frame);
+        // the ISR only stored the raw tick count, convert it here
+        rxFrame._frame.setTimestamp(getRxTimestamp(rxFrame));
+        if (!_dispatcher.dispatch(rxFrame._frame))
+        {
+            notifyListeners(rxFrame._frame);
+        }
         mlock.lock();
         _rxQueue.pop();
     }
 }
 
-void ZephyrCanTransceiver::cyclicTask()
+uint32_t ZephyrCanTransceiver::getRxTimestamp(RxFrame const& rxFrame)
 {
-    can_state canState;
-    can_bus_err_cnt canBusErrCnt;
-    bool busOff = true;
+    uint32_t const rxTimeUs = systemTicks32BitToTimeUs32Bit(rxFrame._frame.timestamp());
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+    // The controller timer counts nominal bit times and is captured at SOF, which is free of
+    // interrupt latency. It is anchored to the system time base by the ISR tick count: the
+    // controller time projected from the anchor must never be later than the ISR time and
+    // should not be earlier than the maximum expected interrupt latency.
+    uint32_t const wrapUs = static_cast<uint32_t>((0x10000ULL * 1000000ULL) / _baudRate);
+    uint16_t const bits   = static_cast<uint16_t>(rxFrame._hwTimestamp - _rxTimestampSync._hwTimestamp);
+    uint32_t const bitsUs = static_cast<uint32_t>((bits * 1000000ULL) / _baudRate);
+    // number of timer wraps since the anchor, rounded to compensate the interrupt latency
+    uint32_t const elapsedUs = rxTimeUs - _rxTimestampSync._timeUs;
+    uint32_t const wraps     = (elapsedUs - bitsUs + (wrapUs / 2U)) / wrapUs;
+
+    uint32_t const projectedUs = _rxTimestampSync._timeUs + (wraps * wrapUs) + bitsUs;
+    int32_t const latencyUs    = static_cast<int32_t>(rxTimeUs - projectedUs);
 
-    if (0 != can_get_state(_canDevice, &canState, &canBusErrCnt))
+    _rxTimestampSync._hwTimestamp = rxFrame._hwTimestamp;
+    if ((!_rxTimestampSync._valid) || (latencyUs < 0) || (latencyUs > MAX_RX_LATENCY_US))
     {
-        logger::Logger::warn(
-            logger::CAN,
-            "Can not get CAN state, assume BUS_OFF for %s",
-            ::common::busid::BusIdTraits::getName(_busId));
+        _rxTimestampSync._timeUs = rxTimeUs;
+        _rxTimestampSync._valid  = true;
+        return rxTimeUs;
     }
-    else 
+    _rxTimestampSync._timeUs = projectedUs;
+    return projectedUs;
+#else
+    return rxTimeUs;
+#endif
+}
+
+void ZephyrCanTransceiver::setBusOffRecovery(
+    BusOffRecovery const recovery, ::etl::span<uint16_t const> const backoffMs)
+{
+    _busOffRecovery    = recovery;
+    _recoveryBackoffMs = backoffMs;
+}
+
+void ZephyrCanTransceiver::stateChangeTask()
+{
+    can_state canState;
     {
-        busOff = (canState == CAN_STATE_BUS_OFF);
+        async::LockType const lock;
+        canState = _canState;
     }
 
-    if (busOff)
+    ::can::ICANTransceiverStateListener::CANTransceiverState transceiverState;
+    switch (canState)
     {
-        if (_transceiverState != ::can::ICANTransceiverStateListener::CANTransceiverState::BUS_OFF)
+        case CAN_STATE_ERROR_ACTIVE:
+        case CAN_STATE_ERROR_WARNING:
+        {
+            transceiverState = ::can::ICANTransceiverStateListener::CANTransceiverState::ACTIVE;
+            break;
+        }
+        case CAN_STATE_ERROR_PASSIVE:
+        {
+            transceiverState = ::can::ICANTransceiverStateListener::CANTransceiverState::PASSIVE;
+            break;
+        }
+        case CAN_STATE_BUS_OFF:
+        {
+            transceiverState = ::can::ICANTransceiverStateListener::CANTransceiverState::BUS_OFF;
+            break;
+        }
+        default:
         {
-            _transceiverState = ::can::ICANTransceiverStateListener::CANTransceiverState::BUS_OFF;
-            notifyStateListenerWithState(_transceiverState);
+            // stopped controller, nothing to report
+            return;
         }
     }
-    else
+
+    if (transceiverState == ::can::ICANTransceiverStateListener::CANTransceiverState::BUS_OFF)
     {
-        if (_transceiverState != ::can::ICANTransceiverStateListener::CANTransceiverState::ACTIVE)
+        if (_transceiverState != transceiverState)
         {
-            _transceiverState = ::can::ICANTransceiverStateListener::CANTransceiverState::ACTIVE;
-            notifyStateListenerWithState(_transceiverState);
+            logger::Logger::warn(
+                logger::CAN, "BUS_OFF on %s", ::common::busid::BusIdTraits::getName(_busId));
+            _recoveryAttempt = 0U;
+            scheduleRecovery();
         }
     }
+    else
+    {
+        _recoveryTimeout.cancel();
+        _recoveryAttempt = 0U;
+    }
+
+    if (_transceiverState != transceiverState)
+    {
+        _transceiverState = transceiverState;
+        notifyStateListenerWithState(_transceiverState);
+    }
+}
+
+void ZephyrCanTransceiver::scheduleRecovery()
+{
+    if ((BusOffRecovery::MANUAL != _busOffRecovery) || _recoveryBackoffMs.empty())
+    {
+        return;
+    }
+    size_t const idx = (_recoveryAttempt < _recoveryBackoffMs.size())
+                           ? _recoveryAttempt
+                           : (_recoveryBackoffMs.size() - 1U);
+    ::async::schedule(
+        _context,
+        _recoveryTask,
+        _recoveryTimeout,
+        _recoveryBackoffMs[idx],
+        ::async::TimeUnit::MILLISECONDS);
+}
+
+void ZephyrCanTransceiver::recoveryTask()
+{
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+    if ((State::OPEN != _state) && (State::MUTED != _state))
+    {
+        return;
+    }
+    logger::Logger::debug(
+        logger::CAN,
+        "Bus-off recovery attempt %d on %s",
+        _recoveryAttempt,
+        ::common::busid::BusIdTraits::getName(_busId));
+    // don't wait here, a successful recovery is reported by the state change callback
+    (void)can_recover(_canDevice, K_NO_WAIT);
+    if (_recoveryAttempt < 0xFFU)
+    {
+        ++_recoveryAttempt;
+    }
+    scheduleRecovery();
+#endif
 }
 
 uint8_t ZephyrCanTransceiver::enqueueRxFrame(
-    uint32_t id, uint8_t length, uint8_t payload[], bool extended, uint8_t const* filterMap)
+    uint32_t id,
+    uint8_t length,
+    uint8_t payload[],
+    bool extended,
+    uint8_t const* filterMap,
+    uint16_t hwTimestamp)
 {
     async::LockType lock;
 
@@ -445,7 +1065,7 @@ uint8_t ZephyrCanTransceiver::enqueueRxFrame(
         bool acceptRxFrame = true;
         if ((nullptr != filterMap) && (false == extended))
         {
-            // apply filter only for std. IDs
+            // bitmap of the merged listener filters, std. IDs only
             uint32_t index = id / 8U;
             uint8_t mask   = 1U << (id % 8U);
             if ((filterMap[index] & mask) == 0)
@@ -453,10 +1073,21 @@ uint8_t ZephyrCanTransceiver::enqueueRxFrame(
                 acceptRxFrame = false;
             }
         }
+        else if (true == extended)
+        {
+            acceptRxFrame = _extendedIdFilter.match(id);
+        }
         if (true == acceptRxFrame)
         {
-            can::CANFrame& frame = _rxQueue.emplace();
-            frame.setTimestamp(getSystemTimeUs32Bit());
+            RxFrame& rxFrame = _rxQueue.emplace();
+            can::CANFrame& frame = rxFrame._frame;
+            // raw ticks are cheap to read, conversion to us is done in receiveTask()
+            frame.setTimestamp(getSystemTicks32Bit());
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+            rxFrame._hwTimestamp = hwTimestamp;
+#else
+            (void)hwTimestamp;
+#endif
             frame.setId(can::CanId::id(id, extended));
             frame.setPayloadLength(length);
             uint8_t* pData = frame.getPayload();
@@ -464,31 +1095,109 @@ uint8_t ZephyrCanTransceiver::enqueueRxFrame(
             return 1;
         }
     }
+    else
+    {
+        ++_statistics._rxDropped;
+    }
     return 0;
 }
 
 void ZephyrCanTransceiver::canFrameReceivedCallback(struct can_frame *frame)
 {
+    // only written here, getStatistics() locks out this ISR while reading
+    ++_statistics._rxFrames;
+    _statistics._rxBitTimes += getFrameBitTimes(*frame);
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    // before routing, fast path and filter so the capture sees the bus as it is
+    captureFrame(::capture::RecordType::CAN_RX, _busId, *frame);
+#endif
+    if (_rxDeadlineMonitor != nullptr)
+    {
+        _rxDeadlineMonitor->frameReceived(frame->id, (frame->flags & CAN_FRAME_IDE) != 0U);
+    }
+    if (_router != nullptr)
+    {
+        // forwarded straight from the driver buffer, local listeners still get the frame
+        (void)_router->route(*frame);
+    }
+    if ((_fastPathHandlerCount > 0U) && runFastPathHandler(*frame))
+    {
+        return;
+    }
     // put into receive queue if filter matches
-    if (enqueueRxFrame(frame->id, frame->dlc, frame->data, frame->flags & CAN_FRAME_IDE,
-        _filter.getRawBitField()))
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+    uint16_t const hwTimestamp = frame->timestamp;
+#else
+    uint16_t const hwTimestamp = 0U;
+#endif
+    if (enqueueRxFrame(frame->id, payloadLength(*frame), frame->data,
+        frame->flags & CAN_FRAME_IDE, _filter.getRawBitField(), hwTimestamp))
     {
         // invoke receiveTask in async context if any frames were received
         ::async::execute(_context, _receiveTask);
     }
 }
 
+bool ZephyrCanTransceiver::runFastPathHandler(struct can_frame const& frame)
+{
+    bool const extended = (frame.flags & CAN_FRAME_IDE) != 0U;
+    for (size_t i = 0U; i < _fastPathHandlerCount; ++i)
+    {
+        FastPathHandler& entry = _fastPathHandlers[i];
+        if ((entry._id == frame.id) && (entry._extended == extended) && entry._enabled)
+        {
+            uint32_t const start  = k_cycle_get_32();
+            bool const consumed   = entry._handler->frameReceivedInIsr(frame, *this);
+            uint32_t const cycles = k_cycle_get_32() - start;
+            ++entry._calls;
+            if (cycles > entry._maxCycles)
+            {
+                entry._maxCycles = cycles;
+            }
+            if (cycles > entry._budgetCycles)
+            {
+                // the overrunning call has already happened, only later frames are protected
+                ++entry._overruns;
+                entry._enabled = false;
+            }
+            return consumed;
+        }
+    }
+    return false;
+}
+
 void ZephyrCanTransceiver::receiveCallback(const struct device * /*dev*/, struct can_frame *frame, void *user_data)
 {
     static_cast<ZephyrCanTransceiver*>(user_data)->canFrameReceivedCallback(frame);
 }
 
-void ZephyrCanTransceiver::transmitCallback(const struct device * /*dev*/, int error, void *user_data)
+void ZephyrCanTransceiver::canStateChangedCallback(enum can_state const state)
 {
-    if (NULL != user_data)
     {
-        static_cast<ZephyrCanTransceiver*>(user_data)->canFrameSentCallback(error);
+        async::LockType const lock;
+        _canState = state;
     }
+    ::async::execute(_context, _stateChangeTask);
+}
+
+void ZephyrCanTransceiver::stateChangeCallback(
+    const struct device * /*dev*/,
+    enum can_state state,
+    struct can_bus_err_cnt /*errCnt*/,
+    void *user_data)
+{
+    static_cast<ZephyrCanTransceiver*>(user_data)->canStateChangedCallback(state);
+}
+
+void ZephyrCanTransceiver::transmitCallback(const struct device * /*dev*/, int error, void *user_data)
+{
+    TxSlot* const pSlot = static_cast<TxSlot*>(user_data);
+    pSlot->_transceiver->canFrameSentCallback(*pSlot, error);
+}
+
+void ZephyrCanTransceiver::transmitDoneCallback(const struct device * /*dev*/, int error, void *user_data)
+{
+    static_cast<ZephyrCanTransceiver*>(user_data)->canFrameDoneCallback(error);
 }
 
 } // namespace bios
@@ -0,0 +1,22 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/ICaptureWriter.h"
+
+namespace capture
+{
+/**
+ * Writes CAN records in the log file format of candump -l, which can be replayed with
+ * canplayer. The bus name is used as interface name, Ethernet records are skipped.
+ */
+class CandumpWriter : public ICaptureWriter
+{
+public:
+    void writeHeader(ICaptureSink& sink) override;
+
+    void writeRecord(ICaptureSink& sink, CaptureRecord const& record, uint64_t timestampUs)
+        override;
+};
+
+} // namespace capture
@@ -0,0 +1,83 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/CaptureRing.h"
+
+#include <etl/span.h>
+
+#include <cstring>
+
+namespace capture
+{
+/**
+ * \return the ring all capture hooks write to
+ */
+CaptureRing& getCaptureRing();
+
+/**
+ * Hook for CAN frames, a single ring write when the capture is enabled.
+ * \param id    CAN ID without flags
+ * \param flags combination of CAN_FLAG_*
+ */
+inline void captureCanFrame(
+    RecordType const type,
+    uint8_t const busId,
+    uint32_t const id,
+    uint8_t const flags,
+    uint8_t const* const data,
+    uint8_t const length)
+{
+    CaptureRecord* const record = getCaptureRing().reserve();
+    if (record == nullptr)
+    {
+        return;
+    }
+    uint16_t const capturedLength
+        = (length > CAPTURE_SNAP_LENGTH) ? static_cast<uint16_t>(CAPTURE_SNAP_LENGTH) : length;
+    record->_type           = type;
+    record->_busId          = busId;
+    record->_id             = id;
+    record->_flags          = flags;
+    record->_length         = length;
+    record->_capturedLength = capturedLength;
+    (void)memcpy(record->_data, data, capturedLength);
+    getCaptureRing().commit(*record);
+}
+
+/**
+ * Address information to synthesize the IP and transport header of a packet of which the
+ * socket layer only sees the payload. Addresses are in network byte order, 4 bytes for IPv4
+ * and 16 bytes for IPv6, ports in host byte order.
+ */
+struct IpInfo
+{
+    uint8_t const* _srcAddr;
+    uint8_t const* _dstAddr;
+    uint16_t _srcPort;
+    uint16_t _dstPort;
+    /** sequence and acknowledge number for TCP */
+    uint32_t _seq;
+    uint32_t _ack;
+    /** IPPROTO_UDP or IPPROTO_TCP */
+    uint8_t _protocol;
+    bool _ipv6;
+};
+
+/**
+ * Writes IPv4/IPv6 and UDP/TCP headers for a payload of the given length, checksums are 0.
+ * \param buffer has to hold at least MAX_IP_HEADERS_LENGTH bytes
+ * \return number of bytes written
+ */
+size_t writeIpHeaders(uint8_t* buffer, IpInfo const& info, size_t payloadLength);
+
+static size_t const MAX_IP_HEADERS_LENGTH = 60U;
+
+/**
+ * Hook for IP payload with synthesized headers, a single ring write when the capture is
+ * enabled.
+ */
+void captureIpPayload(
+    RecordType type, uint8_t busId, IpInfo const& info, ::etl::span<uint8_t const> payload);
+
+} // namespace capture
@@ -0,0 +1,51 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/CaptureRecord.h"
+
+namespace capture
+{
+/**
+ * Condition on a capture record used as filter or trigger.
+ * A record matches if its type is in the type mask, the bus matches and the masked CAN ID
+ * equals the masked reference ID. The ID is ignored for Ethernet records.
+ */
+struct CaptureCondition
+{
+    static uint8_t const ANY_BUS = 0xFFU;
+
+    static uint8_t typeBit(RecordType const type)
+    {
+        return static_cast<uint8_t>(1U << static_cast<uint8_t>(type));
+    }
+
+    /** \return condition matching every record */
+    static CaptureCondition any() { return {0xFFU, ANY_BUS, 0U, 0U}; }
+
+    /** \return condition matching CAN frames of the given types with (id & mask) == id */
+    static CaptureCondition canId(uint8_t const typeMask, uint32_t const id, uint32_t const mask)
+    {
+        return {typeMask, ANY_BUS, id & mask, mask};
+    }
+
+    bool matches(CaptureRecord const& record) const
+    {
+        if ((_typeMask & typeBit(record._type)) == 0U)
+        {
+            return false;
+        }
+        if ((ANY_BUS != _busId) && (_busId != record._busId))
+        {
+            return false;
+        }
+        return (!record.isCan()) || ((record._id & _idMask) == _id);
+    }
+
+    uint8_t _typeMask;
+    uint8_t _busId;
+    uint32_t _id;
+    uint32_t _idMask;
+};
+
+} // namespace capture
@@ -0,0 +1,83 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/CaptureCondition.h"
+#include "capture/CaptureRing.h"
+#include "capture/ICaptureSink.h"
+#include "capture/ICaptureWriter.h"
+
+namespace capture
+{
+/**
+ * Consumer of the capture ring. All filtering and trigger evaluation is done here, outside of
+ * the hooks, when cyclic() drains the ring.
+ *
+ * start() exports every record matching the filter until stop() is called.
+ * arm() keeps the last \p preTrigger records in the ring until a record matches the trigger,
+ * then exports the pre-trigger records, the trigger record and \p postTrigger records and
+ * stops on its own.
+ */
+class CaptureExporter
+{
+public:
+    enum class State : uint8_t
+    {
+        STOPPED,
+        ARMED,
+        RUNNING,
+        TRIGGERED
+    };
+
+    CaptureExporter(CaptureRing& ring, ICaptureWriter& writer, ICaptureSink& sink);
+
+    /**
+     * Only records matching the filter are exported, default is CaptureCondition::any().
+     */
+    void setFilter(CaptureCondition const& filter) { _filter = filter; }
+
+    void start();
+
+    void arm(CaptureCondition const& trigger, uint16_t preTrigger, uint16_t postTrigger);
+
+    void stop();
+
+    /**
+     * Drains the ring, to be called periodically in the context owning the sink.
+     */
+    void cyclic();
+
+    State getState() const { return _state; }
+
+    uint32_t getExportedCount() const { return _exported; }
+
+    /** \return number of records overwritten before they could be exported */
+    uint32_t getLostCount() const { return _lost; }
+
+private:
+    static uint16_t const MAX_RECORDS_PER_CYCLE = 32U;
+
+    void begin(State state);
+    void finish();
+    bool scanForTrigger(uint32_t head);
+    void exportRecords(uint32_t head);
+    uint64_t extendTimestamp(uint32_t timestampUs);
+
+    CaptureRing& _ring;
+    ICaptureWriter& _writer;
+    ICaptureSink& _sink;
+    CaptureCondition _filter;
+    CaptureCondition _trigger;
+    State _state;
+    uint32_t _next;
+    uint32_t _scan;
+    uint32_t _stopAt;
+    uint16_t _preTrigger;
+    uint16_t _postTrigger;
+    uint32_t _exported;
+    uint32_t _lost;
+    uint32_t _lastTimestampUs;
+    uint32_t _timestampHigh;
+};
+
+} // namespace capture
@@ -0,0 +1,48 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <platform/estdint.h>
+
+/** number of bytes stored per captured frame or packet, longer packets are truncated */
+#ifndef CAPTURE_SNAP_LENGTH
+#define CAPTURE_SNAP_LENGTH 128U
+#endif
+
+namespace capture
+{
+enum class RecordType : uint8_t
+{
+    CAN_RX,
+    CAN_TX,
+    ETH_RX,
+    ETH_TX
+};
+
+/** flags of a captured CAN frame */
+static uint8_t const CAN_FLAG_EXTENDED = 0x01U;
+static uint8_t const CAN_FLAG_FD       = 0x02U;
+static uint8_t const CAN_FLAG_BRS      = 0x04U;
+
+/**
+ * One captured CAN frame or IP packet.
+ * For Ethernet the data holds the IP packet starting with the IPv4/IPv6 header.
+ */
+struct CaptureRecord
+{
+    uint32_t _timestampUs;
+    /** CAN ID without flags, 0 for Ethernet */
+    uint32_t _id;
+    /** length of the frame or packet on the bus */
+    uint16_t _length;
+    /** number of bytes in _data, at most CAPTURE_SNAP_LENGTH */
+    uint16_t _capturedLength;
+    RecordType _type;
+    uint8_t _busId;
+    uint8_t _flags;
+    uint8_t _data[CAPTURE_SNAP_LENGTH];
+
+    bool isCan() const { return (_type == RecordType::CAN_RX) || (_type == RecordType::CAN_TX); }
+};
+
+} // namespace capture
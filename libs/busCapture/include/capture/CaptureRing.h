@@ -0,0 +1,82 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/CaptureRecord.h"
+
+#include <zephyr/sys/atomic.h>
+
+/** number of records in the capture ring, has to be a power of 2 */
+#ifndef CAPTURE_RING_SLOT_COUNT
+#define CAPTURE_RING_SLOT_COUNT 64U
+#endif
+
+namespace capture
+{
+/**
+ * Lock-free ring of capture records with any number of producers (tasks and ISRs) and a single
+ * consumer. Producers never wait: a record is reserved by one atomic increment, filled in place
+ * and published by storing its sequence number. When the consumer is too slow the oldest
+ * records are overwritten, the consumer detects this from the sequence numbers.
+ */
+class CaptureRing
+{
+public:
+    static size_t const SLOT_COUNT = CAPTURE_RING_SLOT_COUNT;
+
+    static_assert((SLOT_COUNT & (SLOT_COUNT - 1U)) == 0U, "slot count has to be a power of 2");
+
+    enum class ReadResult : uint8_t
+    {
+        OK,
+        /** the record has not been written completely yet */
+        PENDING,
+        /** the record has already been overwritten by a newer one */
+        OVERWRITTEN
+    };
+
+    CaptureRing();
+
+    void enable() { (void)atomic_set(&_enabled, 1); }
+
+    void disable() { (void)atomic_set(&_enabled, 0); }
+
+    bool isEnabled() const { return 0 != atomic_get(&_enabled); }
+
+    /**
+     * Reserves the next record. The caller fills the record and has to call commit() as soon
+     * as possible, typically from the same function.
+     * \return record to fill or nullptr if the capture is disabled
+     */
+    CaptureRecord* reserve();
+
+    /**
+     * Publishes a record obtained from reserve().
+     */
+    void commit(CaptureRecord& record);
+
+    /**
+     * \return sequence number of the next record to be reserved
+     */
+    uint32_t getHead() const { return static_cast<uint32_t>(atomic_get(&_head)); }
+
+    /**
+     * Copies the record with the given sequence number, to be called by the consumer only.
+     */
+    ReadResult read(uint32_t sequence, CaptureRecord& record) const;
+
+private:
+    struct Slot
+    {
+        /** sequence number + 1 of the published record, 0 while the record is written */
+        atomic_t _published;
+        uint32_t _sequence;
+        CaptureRecord _record;
+    };
+
+    atomic_t _enabled;
+    atomic_t _head;
+    Slot _slots[SLOT_COUNT];
+};
+
+} // namespace capture
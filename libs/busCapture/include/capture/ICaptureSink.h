@@ -0,0 +1,27 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <etl/span.h>
+#include <platform/estdint.h>
+
+namespace capture
+{
+/**
+ * Destination of an exported capture stream.
+ */
+class ICaptureSink
+{
+public:
+    /**
+     * Appends data to the stream, the sink may buffer it.
+     */
+    virtual void write(::etl::span<uint8_t const> data) = 0;
+
+    /**
+     * Pushes buffered data to the destination.
+     */
+    virtual void flush() = 0;
+};
+
+} // namespace capture
@@ -0,0 +1,28 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/CaptureRecord.h"
+#include "capture/ICaptureSink.h"
+
+namespace capture
+{
+/**
+ * Formats capture records into a file format.
+ */
+class ICaptureWriter
+{
+public:
+    /**
+     * Writes the file header, called when an export is started.
+     */
+    virtual void writeHeader(ICaptureSink& sink) = 0;
+
+    /**
+     * \param timestampUs 64 bit timestamp of the record
+     */
+    virtual void writeRecord(ICaptureSink& sink, CaptureRecord const& record, uint64_t timestampUs)
+        = 0;
+};
+
+} // namespace capture
@@ -0,0 +1,41 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/ICaptureWriter.h"
+
+#include <etl/vector.h>
+
+namespace capture
+{
+/**
+ * Writes records in the pcapng format. Each bus becomes an interface: CAN buses use the link
+ * type LINKTYPE_CAN_SOCKETCAN, Ethernet records LINKTYPE_RAW (IP packets without link layer).
+ * Interface description blocks are written when a bus is seen for the first time.
+ */
+class PcapngWriter : public ICaptureWriter
+{
+public:
+    static size_t const MAX_INTERFACES = 8U;
+
+    PcapngWriter();
+
+    void writeHeader(ICaptureSink& sink) override;
+
+    void writeRecord(ICaptureSink& sink, CaptureRecord const& record, uint64_t timestampUs)
+        override;
+
+private:
+    struct Interface
+    {
+        uint8_t _busId;
+        bool _isCan;
+    };
+
+    /** \return interface ID of the record's bus or MAX_INTERFACES if there is no more room */
+    uint32_t getInterfaceId(ICaptureSink& sink, CaptureRecord const& record);
+
+    ::etl::vector<Interface, MAX_INTERFACES> _interfaces;
+};
+
+} // namespace capture
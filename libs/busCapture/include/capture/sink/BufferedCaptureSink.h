@@ -0,0 +1,49 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/ICaptureSink.h"
+
+#include <etl/vector.h>
+
+namespace capture
+{
+/**
+ * Base for sinks transferring data in chunks, e.g. one datagram or one file write per chunk.
+ */
+template<size_t N>
+class BufferedCaptureSink : public ICaptureSink
+{
+public:
+    void write(::etl::span<uint8_t const> data) override
+    {
+        while (!data.empty())
+        {
+            size_t const room  = _buffer.capacity() - _buffer.size();
+            size_t const chunk = (data.size() < room) ? data.size() : room;
+            _buffer.insert(_buffer.end(), data.begin(), data.begin() + chunk);
+            data = data.subspan(chunk);
+            if (_buffer.full())
+            {
+                flush();
+            }
+        }
+    }
+
+    void flush() override
+    {
+        if (!_buffer.empty())
+        {
+            transfer(::etl::span<uint8_t const>(_buffer.data(), _buffer.size()));
+            _buffer.clear();
+        }
+    }
+
+protected:
+    virtual void transfer(::etl::span<uint8_t const> data) = 0;
+
+private:
+    ::etl::vector<uint8_t, N> _buffer;
+};
+
+} // namespace capture
@@ -0,0 +1,35 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/sink/BufferedCaptureSink.h"
+
+namespace capture
+{
+/**
+ * Writes the capture to a file of the host, only available on native_sim.
+ */
+class FileCaptureSink : public BufferedCaptureSink<4096U>
+{
+public:
+    /**
+     * \param path path of the file on the host, relative to the working directory
+     */
+    explicit FileCaptureSink(char const* path) : _path(path), _fd(-1) {}
+
+    /**
+     * Creates or truncates the file.
+     * \return false if the file cannot be opened
+     */
+    bool open();
+
+    void close();
+
+private:
+    void transfer(::etl::span<uint8_t const> data) override;
+
+    char const* const _path;
+    int _fd;
+};
+
+} // namespace capture
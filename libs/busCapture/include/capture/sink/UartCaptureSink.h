@@ -0,0 +1,27 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/ICaptureSink.h"
+
+struct device;
+
+namespace capture
+{
+/**
+ * Streams the capture over a UART which must not be used by the console.
+ */
+class UartCaptureSink : public ICaptureSink
+{
+public:
+    explicit UartCaptureSink(const struct device* uart) : _uart(uart) {}
+
+    void write(::etl::span<uint8_t const> data) override;
+
+    void flush() override {}
+
+private:
+    const struct device* const _uart;
+};
+
+} // namespace capture
@@ -0,0 +1,26 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "capture/sink/BufferedCaptureSink.h"
+
+#include <udp/socket/AbstractDatagramSocket.h>
+
+namespace capture
+{
+/**
+ * Streams the capture as UDP datagrams over a connected socket,
+ * e.g. received on the host with "nc -lu <port> > capture.pcapng".
+ */
+class UdpCaptureSink : public BufferedCaptureSink<1024U>
+{
+public:
+    explicit UdpCaptureSink(::udp::AbstractDatagramSocket& socket) : _socket(socket) {}
+
+private:
+    void transfer(::etl::span<uint8_t const> data) override;
+
+    ::udp::AbstractDatagramSocket& _socket;
+};
+
+} // namespace capture
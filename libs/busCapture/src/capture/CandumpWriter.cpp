@@ -0,0 +1,63 @@
+// Copyright 2025 Accenture.
+
+#include "capture/CandumpWriter.h"
+
+#include <common/busid/BusId.h>
+
+#include <cstdio>
+
+namespace
+{
+char const HEX_DIGITS[] = "0123456789ABCDEF";
+
+// "(" seconds "." micros ") " name " " ID "##" flags data "\n"
+size_t const MAX_LINE_LENGTH = 64U + (2U * CAPTURE_SNAP_LENGTH);
+} // namespace
+
+namespace capture
+{
+void CandumpWriter::writeHeader(ICaptureSink& /*sink*/)
+{
+    // the candump log format has no header
+}
+
+void CandumpWriter::writeRecord(
+    ICaptureSink& sink, CaptureRecord const& record, uint64_t const timestampUs)
+{
+    if (!record.isCan())
+    {
+        return;
+    }
+
+    char line[MAX_LINE_LENGTH];
+    int const prefix = snprintf(
+        line,
+        sizeof(line),
+        ((record._flags & CAN_FLAG_EXTENDED) != 0U) ? "(%lu.%06lu) %s %08lX#" : "(%lu.%06lu) %s %03lX#",
+        static_cast<unsigned long>(timestampUs / 1000000U),
+        static_cast<unsigned long>(timestampUs % 1000000U),
+        ::common::busid::BusIdTraits::getName(record._busId),
+        static_cast<unsigned long>(record._id));
+    if ((prefix < 0) || (static_cast<size_t>(prefix) >= sizeof(line)))
+    {
+        return;
+    }
+
+    size_t length = static_cast<size_t>(prefix);
+    if ((record._flags & CAN_FLAG_FD) != 0U)
+    {
+        // FD frames: "##" followed by one hex digit with the flags, bit 0 is BRS
+        line[length++] = '#';
+        line[length++] = HEX_DIGITS[((record._flags & CAN_FLAG_BRS) != 0U) ? 1U : 0U];
+    }
+    for (size_t i = 0U; i < record._capturedLength; ++i)
+    {
+        line[length++] = HEX_DIGITS[record._data[i] >> 4U];
+        line[length++] = HEX_DIGITS[record._data[i] & 0x0FU];
+    }
+    line[length++] = '\n';
+
+    sink.write(::etl::span<uint8_t const>(reinterpret_cast<uint8_t const*>(line), length));
+}
+
+} // namespace capture
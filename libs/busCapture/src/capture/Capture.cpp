@@ -0,0 +1,111 @@
+// Copyright 2025 Accenture.
+
+#include "capture/Capture.h"
+
+namespace
+{
+uint8_t const IPV4_HEADER_LENGTH = 20U;
+uint8_t const IPV6_HEADER_LENGTH = 40U;
+uint8_t const UDP_HEADER_LENGTH  = 8U;
+uint8_t const TCP_HEADER_LENGTH  = 20U;
+uint8_t const IPPROTO_TCP_VALUE  = 6U;
+uint8_t const DEFAULT_TTL        = 64U;
+
+static_assert(
+    ::capture::MAX_IP_HEADERS_LENGTH == (IPV6_HEADER_LENGTH + TCP_HEADER_LENGTH),
+    "inconsistent header length");
+static_assert(CAPTURE_SNAP_LENGTH > ::capture::MAX_IP_HEADERS_LENGTH, "snap length too short");
+
+::capture::CaptureRing captureRing;
+
+uint8_t* writeU16(uint8_t* const buffer, uint16_t const value)
+{
+    buffer[0] = static_cast<uint8_t>(value >> 8U);
+    buffer[1] = static_cast<uint8_t>(value);
+    return buffer + 2U;
+}
+
+uint8_t* writeU32(uint8_t* const buffer, uint32_t const value)
+{
+    (void)writeU16(buffer, static_cast<uint16_t>(value >> 16U));
+    return writeU16(buffer + 2U, static_cast<uint16_t>(value));
+}
+
+} // namespace
+
+namespace capture
+{
+CaptureRing& getCaptureRing() { return captureRing; }
+
+size_t writeIpHeaders(uint8_t* const buffer, IpInfo const& info, size_t const payloadLength)
+{
+    bool const tcp           = (IPPROTO_TCP_VALUE == info._protocol);
+    size_t const l4Header    = tcp ? TCP_HEADER_LENGTH : UDP_HEADER_LENGTH;
+    size_t const ipHeader    = info._ipv6 ? IPV6_HEADER_LENGTH : IPV4_HEADER_LENGTH;
+    size_t const l4Length    = l4Header + payloadLength;
+    size_t const totalLength = ipHeader + l4Length;
+
+    uint8_t* p = buffer;
+    (void)memset(p, 0, ipHeader + l4Header);
+    if (info._ipv6)
+    {
+        p[0] = 0x60U;
+        (void)writeU16(&p[4], static_cast<uint16_t>(l4Length));
+        p[6] = info._protocol;
+        p[7] = DEFAULT_TTL;
+        (void)memcpy(&p[8], info._srcAddr, 16U);
+        (void)memcpy(&p[24], info._dstAddr, 16U);
+    }
+    else
+    {
+        p[0] = 0x45U;
+        (void)writeU16(&p[2], static_cast<uint16_t>(totalLength));
+        p[8] = DEFAULT_TTL;
+        p[9] = info._protocol;
+        (void)memcpy(&p[12], info._srcAddr, 4U);
+        (void)memcpy(&p[16], info._dstAddr, 4U);
+    }
+    p += ipHeader;
+    p = writeU16(p, info._srcPort);
+    p = writeU16(p, info._dstPort);
+    if (tcp)
+    {
+        p    = writeU32(p, info._seq);
+        p    = writeU32(p, info._ack);
+        p[0] = static_cast<uint8_t>((TCP_HEADER_LENGTH / 4U) << 4U);
+        // PSH | ACK
+        p[1] = 0x18U;
+    }
+    else
+    {
+        (void)writeU16(p, static_cast<uint16_t>(l4Length));
+    }
+    return ipHeader + l4Header;
+}
+
+void captureIpPayload(
+    RecordType const type,
+    uint8_t const busId,
+    IpInfo const& info,
+    ::etl::span<uint8_t const> const payload)
+{
+    CaptureRecord* const record = captureRing.reserve();
+    if (record == nullptr)
+    {
+        return;
+    }
+    size_t const headerLength = writeIpHeaders(record->_data, info, payload.size());
+    size_t const room         = CAPTURE_SNAP_LENGTH - headerLength;
+    size_t const copied       = (payload.size() > room) ? room : payload.size();
+    (void)memcpy(&record->_data[headerLength], payload.data(), copied);
+
+    record->_type           = type;
+    record->_busId          = busId;
+    record->_id             = 0U;
+    record->_flags          = 0U;
+    record->_length         = static_cast<uint16_t>(headerLength + payload.size());
+    record->_capturedLength = static_cast<uint16_t>(headerLength + copied);
+    captureRing.commit(*record);
+}
+
+} // namespace capture
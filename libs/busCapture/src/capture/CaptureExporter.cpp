@@ -0,0 +1,172 @@
+// Copyright 2025 Accenture.
+
+#include "capture/CaptureExporter.h"
+
+namespace capture
+{
+CaptureExporter::CaptureExporter(CaptureRing& ring, ICaptureWriter& writer, ICaptureSink& sink)
+: _ring(ring)
+, _writer(writer)
+, _sink(sink)
+, _filter(CaptureCondition::any())
+, _trigger(CaptureCondition::any())
+, _state(State::STOPPED)
+, _next(0U)
+, _scan(0U)
+, _stopAt(0U)
+, _preTrigger(0U)
+, _postTrigger(0U)
+, _exported(0U)
+, _lost(0U)
+, _lastTimestampUs(0U)
+, _timestampHigh(0U)
+{}
+
+void CaptureExporter::start() { begin(State::RUNNING); }
+
+void CaptureExporter::arm(
+    CaptureCondition const& trigger, uint16_t const preTrigger, uint16_t const postTrigger)
+{
+    _trigger     = trigger;
+    _preTrigger  = preTrigger;
+    _postTrigger = postTrigger;
+    begin(State::ARMED);
+}
+
+void CaptureExporter::begin(State const state)
+{
+    if (State::STOPPED != _state)
+    {
+        finish();
+    }
+    _next     = _ring.getHead();
+    _scan     = _next;
+    _exported = 0U;
+    _lost     = 0U;
+    _state    = state;
+    _writer.writeHeader(_sink);
+    _ring.enable();
+}
+
+void CaptureExporter::stop()
+{
+    if (State::STOPPED != _state)
+    {
+        finish();
+    }
+}
+
+void CaptureExporter::finish()
+{
+    _ring.disable();
+    _sink.flush();
+    _state = State::STOPPED;
+}
+
+void CaptureExporter::cyclic()
+{
+    if (State::STOPPED == _state)
+    {
+        return;
+    }
+    uint32_t const head = _ring.getHead();
+    if ((head - _next) > CaptureRing::SLOT_COUNT)
+    {
+        // producers have lapped the consumer
+        uint32_t const oldest = head - CaptureRing::SLOT_COUNT;
+        if (State::ARMED != _state)
+        {
+            _lost += oldest - _next;
+        }
+        _next = oldest;
+    }
+
+    if ((State::ARMED == _state) && (!scanForTrigger(head)))
+    {
+        return;
+    }
+    exportRecords(head);
+    _sink.flush();
+}
+
+bool CaptureExporter::scanForTrigger(uint32_t const head)
+{
+    if (static_cast<int32_t>(_scan - _next) < 0)
+    {
+        _scan = _next;
+    }
+    CaptureRecord record;
+    while (_scan != head)
+    {
+        CaptureRing::ReadResult const result = _ring.read(_scan, record);
+        if (CaptureRing::ReadResult::PENDING == result)
+        {
+            break;
+        }
+        if ((CaptureRing::ReadResult::OK == result) && _trigger.matches(record))
+        {
+            _state  = State::TRIGGERED;
+            _stopAt = _scan + _postTrigger + 1U;
+            if ((_scan - _next) > _preTrigger)
+            {
+                _next = _scan - _preTrigger;
+            }
+            return true;
+        }
+        ++_scan;
+    }
+    // forget records which are too old to be exported as pre-trigger history
+    if ((_scan - _next) > _preTrigger)
+    {
+        _next = _scan - _preTrigger;
+    }
+    return false;
+}
+
+void CaptureExporter::exportRecords(uint32_t const head)
+{
+    CaptureRecord record;
+    uint16_t count = 0U;
+    while ((_next != head) && (count < MAX_RECORDS_PER_CYCLE))
+    {
+        if ((State::TRIGGERED == _state) && (_next == _stopAt))
+        {
+            finish();
+            return;
+        }
+        CaptureRing::ReadResult const result = _ring.read(_next, record);
+        if (CaptureRing::ReadResult::PENDING == result)
+        {
+            return;
+        }
+        if (CaptureRing::ReadResult::OVERWRITTEN == result)
+        {
+            ++_lost;
+        }
+        else if (_filter.matches(record))
+        {
+            _writer.writeRecord(_sink, record, extendTimestamp(record._timestampUs));
+            ++_exported;
+        }
+        ++_next;
+        ++count;
+    }
+    if ((State::TRIGGERED == _state) && (_next == _stopAt))
+    {
+        finish();
+    }
+}
+
+uint64_t CaptureExporter::extendTimestamp(uint32_t const timestampUs)
+{
+    // records are exported in order of reservation, a smaller timestamp means a wrap around
+    // unless it is a small step back caused by concurrent producers
+    if ((timestampUs < _lastTimestampUs) && ((_lastTimestampUs - timestampUs) > 0x80000000U))
+    {
+        ++_timestampHigh;
+    }
+    _lastTimestampUs = timestampUs;
+    return (static_cast<uint64_t>(_timestampHigh) << 32U) | timestampUs;
+}
+
+} // namespace capture
@@ -0,0 +1,54 @@
+// Copyright 2025 Accenture.
+
+#include "capture/CaptureRing.h"
+
+#include <bsp/timer/SystemTimer.h>
+
+#include <cstddef>
+
+namespace capture
+{
+CaptureRing::CaptureRing() : _enabled(ATOMIC_INIT(0)), _head(ATOMIC_INIT(0)), _slots() {}
+
+CaptureRecord* CaptureRing::reserve()
+{
+    if (!isEnabled())
+    {
+        return nullptr;
+    }
+    uint32_t const sequence = static_cast<uint32_t>(atomic_inc(&_head));
+    Slot& slot              = _slots[sequence & (SLOT_COUNT - 1U)];
+    (void)atomic_set(&slot._published, 0);
+    slot._sequence            = sequence;
+    slot._record._timestampUs = getSystemTimeUs32Bit();
+    return &slot._record;
+}
+
+void CaptureRing::commit(CaptureRecord& record)
+{
+    Slot& slot = *reinterpret_cast<Slot*>(
+        reinterpret_cast<uint8_t*>(&record) - offsetof(Slot, _record));
+    (void)atomic_set(&slot._published, static_cast<atomic_val_t>(slot._sequence + 1U));
+}
+
+CaptureRing::ReadResult CaptureRing::read(uint32_t const sequence, CaptureRecord& record) const
+{
+    Slot const& slot         = _slots[sequence & (SLOT_COUNT - 1U)];
+    uint32_t const published = static_cast<uint32_t>(atomic_get(&slot._published));
+    if (published != (sequence + 1U))
+    {
+        // 0 or an older sequence: the producer is still writing
+        return ((0U == published) || (static_cast<int32_t>(published - (sequence + 1U)) < 0))
+                   ? ReadResult::PENDING
+                   : ReadResult::OVERWRITTEN;
+    }
+    record = slot._record;
+    // a producer may have reserved the slot again while it was copied
+    if (static_cast<uint32_t>(atomic_get(&slot._published)) != published)
+    {
+        return ReadResult::OVERWRITTEN;
+    }
+    return ReadResult::OK;
+}
+
+} // namespace capture
@@ -0,0 +1,146 @@
+// Copyright 2025 Accenture.
+
+#include "capture/PcapngWriter.h"
+
+#include <cstring>
+
+namespace
+{
+uint32_t const SECTION_HEADER_BLOCK        = 0x0A0D0D0AU;
+uint32_t const INTERFACE_DESCRIPTION_BLOCK = 0x00000001U;
+uint32_t const ENHANCED_PACKET_BLOCK       = 0x00000006U;
+uint32_t const BYTE_ORDER_MAGIC            = 0x1A2B3C4DU;
+
+uint16_t const LINKTYPE_RAW           = 101U;
+uint16_t const LINKTYPE_CAN_SOCKETCAN = 227U;
+
+// SocketCAN header: ID (big endian), payload length, FD flags, 2 reserved bytes
+size_t const SOCKETCAN_HEADER_LENGTH = 8U;
+uint32_t const SOCKETCAN_EFF_FLAG    = 0x80000000U;
+uint8_t const SOCKETCAN_FD_BRS       = 0x01U;
+uint8_t const SOCKETCAN_FD_FDF       = 0x04U;
+
+// block type, block length, interface ID, timestamp (2 words), captured and original length
+size_t const EPB_HEADER_LENGTH = 28U;
+size_t const EPB_MAX_DATA      = SOCKETCAN_HEADER_LENGTH + CAPTURE_SNAP_LENGTH + 3U;
+
+void put32(uint8_t* const buffer, uint32_t const value) { (void)memcpy(buffer, &value, 4U); }
+
+void put16(uint8_t* const buffer, uint16_t const value) { (void)memcpy(buffer, &value, 2U); }
+
+} // namespace
+
+namespace capture
+{
+PcapngWriter::PcapngWriter() : _interfaces() {}
+
+void PcapngWriter::writeHeader(ICaptureSink& sink)
+{
+    _interfaces.clear();
+
+    uint8_t block[28];
+    put32(&block[0], SECTION_HEADER_BLOCK);
+    put32(&block[4], sizeof(block));
+    put32(&block[8], BYTE_ORDER_MAGIC);
+    // version 1.0
+    put16(&block[12], 1U);
+    put16(&block[14], 0U);
+    // section length unknown
+    put32(&block[16], 0xFFFFFFFFU);
+    put32(&block[20], 0xFFFFFFFFU);
+    put32(&block[24], sizeof(block));
+    sink.write(::etl::span<uint8_t const>(block, sizeof(block)));
+}
+
+uint32_t PcapngWriter::getInterfaceId(ICaptureSink& sink, CaptureRecord const& record)
+{
+    bool const isCan = record.isCan();
+    for (size_t i = 0U; i < _interfaces.size(); ++i)
+    {
+        if ((_interfaces[i]._busId == record._busId) && (_interfaces[i]._isCan == isCan))
+        {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    if (_interfaces.full())
+    {
+        return MAX_INTERFACES;
+    }
+    _interfaces.push_back({record._busId, isCan});
+
+    // no options, the default timestamp resolution is 1 us
+    uint8_t block[20];
+    put32(&block[0], INTERFACE_DESCRIPTION_BLOCK);
+    put32(&block[4], sizeof(block));
+    put16(&block[8], isCan ? LINKTYPE_CAN_SOCKETCAN : LINKTYPE_RAW);
+    put16(&block[10], 0U);
+    put32(&block[12], static_cast<uint32_t>(SOCKETCAN_HEADER_LENGTH + CAPTURE_SNAP_LENGTH));
+    put32(&block[16], sizeof(block));
+    sink.write(::etl::span<uint8_t const>(block, sizeof(block)));
+    return static_cast<uint32_t>(_interfaces.size() - 1U);
+}
+
+void PcapngWriter::writeRecord(
+    ICaptureSink& sink, CaptureRecord const& record, uint64_t const timestampUs)
+{
+    uint32_t const interfaceId = getInterfaceId(sink, record);
+    if (interfaceId >= MAX_INTERFACES)
+    {
+        return;
+    }
+
+    uint8_t data[EPB_MAX_DATA];
+    size_t capturedLength = 0U;
+    size_t originalLength = record._length;
+    if (record.isCan())
+    {
+        uint32_t id = record._id;
+        if ((record._flags & CAN_FLAG_EXTENDED) != 0U)
+        {
+            id |= SOCKETCAN_EFF_FLAG;
+        }
+        data[0] = static_cast<uint8_t>(id >> 24U);
+        data[1] = static_cast<uint8_t>(id >> 16U);
+        data[2] = static_cast<uint8_t>(id >> 8U);
+        data[3] = static_cast<uint8_t>(id);
+        data[4] = static_cast<uint8_t>(record._length);
+        data[5] = 0U;
+        if ((record._flags & CAN_FLAG_FD) != 0U)
+        {
+            data[5] = SOCKETCAN_FD_FDF;
+            if ((record._flags & CAN_FLAG_BRS) != 0U)
+            {
+                data[5] |= SOCKETCAN_FD_BRS;
+            }
+        }
+        data[6] = 0U;
+        data[7] = 0U;
+        (void)memcpy(&data[SOCKETCAN_HEADER_LENGTH], record._data, record._capturedLength);
+        capturedLength = SOCKETCAN_HEADER_LENGTH + record._capturedLength;
+        originalLength += SOCKETCAN_HEADER_LENGTH;
+    }
+    else
+    {
+        (void)memcpy(data, record._data, record._capturedLength);
+        capturedLength = record._capturedLength;
+    }
+    size_t const paddedLength = (capturedLength + 3U) & ~static_cast<size_t>(3U);
+    (void)memset(&data[capturedLength], 0, paddedLength - capturedLength);
+
+    uint32_t const blockLength = static_cast<uint32_t>(EPB_HEADER_LENGTH + paddedLength + 4U);
+    uint8_t header[EPB_HEADER_LENGTH];
+    put32(&header[0], ENHANCED_PACKET_BLOCK);
+    put32(&header[4], blockLength);
+    put32(&header[8], interfaceId);
+    put32(&header[12], static_cast<uint32_t>(timestampUs >> 32U));
+    put32(&header[16], static_cast<uint32_t>(timestampUs));
+    put32(&header[20], static_cast<uint32_t>(capturedLength));
+    put32(&header[24], static_cast<uint32_t>(originalLength));
+    sink.write(::etl::span<uint8_t const>(header, sizeof(header)));
+    sink.write(::etl::span<uint8_t const>(data, paddedLength));
+    uint8_t trailer[4];
+    put32(trailer, blockLength);
+    sink.write(::etl::span<uint8_t const>(trailer, sizeof(trailer)));
+}
+
+} // namespace capture
@@ -0,0 +1,34 @@
+// Copyright 2025 Accenture.
+
+#include "capture/sink/FileCaptureSink.h"
+
+#include "native_sim/FileCaptureSinkAdapt.h"
+
+namespace capture
+{
+bool FileCaptureSink::open()
+{
+    close();
+    _fd = capture_host_file_open(_path);
+    return _fd >= 0;
+}
+
+void FileCaptureSink::close()
+{
+    if (_fd >= 0)
+    {
+        flush();
+        capture_host_file_close(_fd);
+        _fd = -1;
+    }
+}
+
+void FileCaptureSink::transfer(::etl::span<uint8_t const> const data)
+{
+    if (_fd >= 0)
+    {
+        (void)capture_host_file_write(_fd, data.data(), data.size());
+    }
+}
+
+} // namespace capture
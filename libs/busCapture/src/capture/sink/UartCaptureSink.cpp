@@ -0,0 +1,17 @@
+// Copyright 2025 Accenture.
+
+#include "capture/sink/UartCaptureSink.h"
+
+#include <zephyr/drivers/uart.h>
+
+namespace capture
+{
+void UartCaptureSink::write(::etl::span<uint8_t const> const data)
+{
+    for (uint8_t const byte : data)
+    {
+        uart_poll_out(_uart, byte);
+    }
+}
+
+} // namespace capture
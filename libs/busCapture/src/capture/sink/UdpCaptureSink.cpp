@@ -0,0 +1,12 @@
+// Copyright 2025 Accenture.
+
+#include "capture/sink/UdpCaptureSink.h"
+
+namespace capture
+{
+void UdpCaptureSink::transfer(::etl::span<uint8_t const> const data)
+{
+    (void)_socket.send(data);
+}
+
+} // namespace capture
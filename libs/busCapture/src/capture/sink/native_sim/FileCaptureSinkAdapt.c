@@ -0,0 +1,21 @@
+// Copyright 2025 Accenture.
+
+#include "FileCaptureSinkAdapt.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+int capture_host_file_open(const char *path)
+{
+    return open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+}
+
+int capture_host_file_write(int fd, const void *data, size_t length)
+{
+    return (int)write(fd, data, length);
+}
+
+void capture_host_file_close(int fd)
+{
+    (void)close(fd);
+}
@@ -0,0 +1,24 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+/*
+ * Host side of FileCaptureSink, compiled against the host C library as part of the native
+ * simulator runner.
+ */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int capture_host_file_open(const char *path);
+
+int capture_host_file_write(int fd, const void *data, size_t length);
+
+void capture_host_file_close(int fd);
+
+#ifdef __cplusplus
+}
+#endif
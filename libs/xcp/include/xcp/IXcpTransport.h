@@ -0,0 +1,43 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <platform/estdint.h>
+
+namespace xcp
+{
+/**
+ * Transport layer of an XcpSlave, carries command, response and DTO packets.
+ *
+ * Packets are built in place: allocatePacket() returns a buffer inside the pending transmit
+ * batch, commitPacket() adds it to the batch and flush() hands the whole batch to the bus.
+ * All calls are made from the context of the XcpSlave.
+ */
+class IXcpTransport
+{
+public:
+    /** \return maximum length of command and response packets */
+    virtual uint8_t getMaxCto() const = 0;
+
+    /** \return maximum length of DAQ packets */
+    virtual uint16_t getMaxDto() const = 0;
+
+    /**
+     * Returns a buffer for a packet of up to maxLength bytes. If the pending batch has no room
+     * for it, the batch is flushed first.
+     * \return nullptr if the packet can't be allocated, e.g. because maxLength is too long
+     */
+    virtual uint8_t* allocatePacket(uint16_t maxLength) = 0;
+
+    /**
+     * Adds the last allocated packet with the given length to the pending batch.
+     */
+    virtual void commitPacket(uint16_t length) = 0;
+
+    /**
+     * Sends all committed packets.
+     */
+    virtual void flush() = 0;
+};
+
+} // namespace xcp
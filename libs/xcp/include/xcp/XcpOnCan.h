@@ -0,0 +1,66 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "xcp/IXcpTransport.h"
+
+#include <can/canframes/CANFrame.h>
+#include <can/filter/IntervalFilter.h>
+#include <can/framemgmt/ICANFrameListener.h>
+#include <platform/estdint.h>
+
+namespace bios
+{
+class ZephyrCanTransceiver;
+}
+
+namespace xcp
+{
+class XcpSlave;
+
+/**
+ * XCP on classic CAN: commands are received with the CRO ID, responses and DTOs are sent with
+ * the DTO ID. Packets are built directly in a batch of frames which is handed over to the
+ * transceiver with a single batch write, so the DTOs of one event don't take the transceiver
+ * lock once per frame.
+ */
+class XcpOnCan
+: public IXcpTransport
+, public ::can::ICANFrameListener
+{
+public:
+    /** maximum number of frames sent by one batch write */
+    static size_t const MAX_BATCH_SIZE = 16U;
+
+    /**
+     * \param croId CAN ID of command packets as built by ::can::CanId::id()
+     * \param dtoId CAN ID of response and DAQ packets as built by ::can::CanId::id()
+     */
+    XcpOnCan(XcpSlave& slave, uint32_t croId, uint32_t dtoId);
+
+    void start(::bios::ZephyrCanTransceiver& transceiver);
+    void stop();
+
+    uint8_t getMaxCto() const override;
+    uint16_t getMaxDto() const override;
+    uint8_t* allocatePacket(uint16_t maxLength) override;
+    void commitPacket(uint16_t length) override;
+    void flush() override;
+
+    void frameReceived(::can::CANFrame const& frame) override;
+    ::can::IFilter& getFilter() override { return _filter; }
+
+    /** \return frames not accepted by the transceiver */
+    uint32_t getTxFailureCount() const { return _txFailures; }
+
+private:
+    XcpSlave& _slave;
+    ::bios::ZephyrCanTransceiver* _transceiver;
+    ::can::IntervalFilter _filter;
+    uint32_t const _dtoId;
+    ::can::CANFrame _frames[MAX_BATCH_SIZE];
+    size_t _frameCount;
+    uint32_t _txFailures;
+};
+
+} // namespace xcp
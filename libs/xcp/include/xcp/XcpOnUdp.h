@@ -0,0 +1,70 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "xcp/IXcpTransport.h"
+
+#include <ip/IPAddress.h>
+#include <udp/IDataListener.h>
+#include <udp/socket/AbstractDatagramSocket.h>
+#include <platform/estdint.h>
+
+namespace xcp
+{
+class XcpSlave;
+
+/**
+ * XCP on Ethernet over UDP. Each packet is preceded by the header of XCP on Ethernet, a 16 bit
+ * length and a 16 bit counter. The packets committed until flush() are sent as one datagram,
+ * so all DTOs of one event cost a single send() to the stack. The master is the sender of the
+ * last received CONNECT, commands of other senders are ignored.
+ */
+class XcpOnUdp
+: public IXcpTransport
+, public ::udp::IDataListener
+{
+public:
+    /** payload of a datagram without fragmentation at an MTU of 1500 bytes */
+    static size_t const MAX_DATAGRAM_LENGTH = 1472U;
+    static uint8_t const MAX_CTO            = 64U;
+    static uint16_t const MAX_DTO           = 512U;
+
+    XcpOnUdp(XcpSlave& slave, ::udp::AbstractDatagramSocket& socket);
+
+    /**
+     * Binds the socket to the given port on all interfaces.
+     */
+    bool start(uint16_t port);
+    void stop();
+
+    uint8_t getMaxCto() const override;
+    uint16_t getMaxDto() const override;
+    uint8_t* allocatePacket(uint16_t maxLength) override;
+    void commitPacket(uint16_t length) override;
+    void flush() override;
+
+    void dataReceived(
+        ::udp::AbstractDatagramSocket& socket,
+        ::ip::IPAddress sourceAddress,
+        uint16_t sourcePort,
+        ::ip::IPAddress destinationAddress,
+        uint16_t length) override;
+
+    /** \return datagrams not accepted by the socket */
+    uint32_t getTxFailureCount() const { return _txFailures; }
+
+private:
+    static size_t const HEADER_LENGTH = 4U;
+
+    XcpSlave& _slave;
+    ::udp::AbstractDatagramSocket& _socket;
+    ::ip::IPAddress _masterAddress;
+    uint16_t _masterPort;
+    uint16_t _txCounter;
+    size_t _txLength;
+    uint32_t _txFailures;
+    uint8_t _rxBuffer[MAX_DATAGRAM_LENGTH];
+    uint8_t _txBuffer[MAX_DATAGRAM_LENGTH];
+};
+
+} // namespace xcp
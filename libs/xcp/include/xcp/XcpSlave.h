@@ -0,0 +1,268 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "xcp/IXcpTransport.h"
+
+#include <async/Async.h>
+#include <async/util/Call.h>
+#include <etl/span.h>
+#include <platform/estdint.h>
+
+namespace xcp
+{
+/**
+ * Memory made accessible to the master. The address extension of XCP addresses selects the
+ * region by its index, the address is the offset within the region. So the master never sees
+ * raw pointers and every access is range checked.
+ */
+struct XcpMemoryRegion
+{
+    uint8_t* _base;
+    uint32_t _size;
+    bool _writable;
+};
+
+/**
+ * DAQ event channel, triggered by calling XcpSlave::event() with its index.
+ */
+struct XcpEventChannel
+{
+    char const* _name;
+    /** period in which the application triggers the event */
+    uint8_t _cycleMs;
+};
+
+/**
+ * XCP slave with dynamic DAQ lists, independent of the transport layer.
+ *
+ * Commands are received from any context through commandReceived() and processed in the
+ * context of the slave, the response is sent on the transport which received CONNECT.
+ *
+ * DAQ lists are compiled when they are started: the ODT entries of each ODT are resolved to
+ * pointers and adjacent entries are merged into a gather list, so sampling an ODT is a PID
+ * byte, an optional timestamp and one memcpy() per gather segment directly into the transmit
+ * buffer of the transport. All ODTs of an event are flushed to the transport as one batch.
+ *
+ * Supported commands: CONNECT, DISCONNECT, GET_STATUS, SYNCH, GET_COMM_MODE_INFO, SET_MTA,
+ * UPLOAD, SHORT_UPLOAD, DOWNLOAD, the DAQ info commands, FREE_DAQ, ALLOC_DAQ, ALLOC_ODT,
+ * ALLOC_ODT_ENTRY, SET_DAQ_PTR, WRITE_DAQ, SET_DAQ_LIST_MODE, GET_DAQ_LIST_MODE,
+ * START_STOP_DAQ_LIST, START_STOP_SYNCH and GET_DAQ_CLOCK.
+ * Byte order is Intel, the identification field is the absolute ODT number, timestamps have
+ * 4 bytes with a resolution of 1 us.
+ */
+class XcpSlave
+{
+public:
+    /** maximum length of a command packet */
+    static uint8_t const MAX_CTO = 64U;
+    /** maximum number of ODTs, the absolute ODT number must be below the PIDs of responses */
+    static size_t const MAX_ODT_COUNT = 0xFCU;
+
+    struct DaqList
+    {
+        uint16_t _firstOdt;
+        uint16_t _eventChannel;
+        uint8_t _odtCount;
+        uint8_t _mode;
+        uint8_t _prescaler;
+        uint8_t _prescalerCounter;
+        uint8_t _priority;
+        bool _selected;
+        bool _running;
+    };
+
+    struct Odt
+    {
+        /** first entry, also the first gather segment after compilation */
+        uint16_t _firstEntry;
+        uint8_t _entryCount;
+        uint8_t _segmentCount;
+        /** length of the DTO including PID and timestamp */
+        uint16_t _length;
+    };
+
+    struct OdtEntry
+    {
+        uint8_t const* _source;
+        uint8_t _size;
+    };
+
+    struct GatherSegment
+    {
+        uint8_t const* _source;
+        uint16_t _length;
+    };
+
+    struct EventStatistics
+    {
+        /** events with at least one running DAQ list */
+        uint32_t _samples;
+        /** DTO packets sent */
+        uint32_t _odts;
+        /** sampled ODT entries, i.e. signals */
+        uint32_t _entries;
+        /** sampled payload bytes */
+        uint32_t _bytes;
+        /** DTO packets lost because the transport had no room */
+        uint32_t _overruns;
+        /** cycles of event() including the transmission, see k_cycle_get_32() */
+        uint64_t _cycles;
+        uint32_t _maxCycles;
+    };
+
+    /**
+     * \param context    context processing the commands, event() must be called from it
+     * \param regions    memory accessible by address extension 0..n-1
+     * \param events     event channels
+     * \param statistics storage for the statistics, same size as events
+     * \param daqLists   storage for the DAQ lists
+     * \param odts       storage for the ODTs, at most MAX_ODT_COUNT
+     * \param entries    storage for the ODT entries
+     * \param segments   storage for the gather lists, same size as entries
+     */
+    XcpSlave(
+        ::async::ContextType context,
+        ::etl::span<XcpMemoryRegion const> regions,
+        ::etl::span<XcpEventChannel const> events,
+        ::etl::span<EventStatistics> statistics,
+        ::etl::span<DaqList> daqLists,
+        ::etl::span<Odt> odts,
+        ::etl::span<OdtEntry> entries,
+        ::etl::span<GatherSegment> segments);
+
+    /**
+     * Called by a transport for each received command packet, from any context. Commands
+     * received while the previous one is still being processed are dropped.
+     */
+    void commandReceived(IXcpTransport& transport, uint8_t const data[], size_t length);
+
+    /**
+     * Samples and sends the running DAQ lists of the given event channel.
+     * Must be called from the context of the slave.
+     */
+    void event(size_t channel);
+
+    /**
+     * Stops all DAQ lists and disconnects, e.g. when the transport goes down.
+     */
+    void disconnect();
+
+    bool isConnected() const { return _transport != nullptr; }
+
+    size_t getRunningDaqListCount() const { return _runningCount; }
+
+    size_t getEventCount() const { return _events.size(); }
+
+    XcpEventChannel const& getEvent(size_t channel) const { return _events[channel]; }
+
+    EventStatistics const& getStatistics(size_t channel) const { return _statistics[channel]; }
+
+    /** \return time in ms since the statistics have been reset */
+    uint32_t getStatisticsAgeMs() const;
+
+    void resetStatistics();
+
+    uint32_t getDroppedCommandCount() const { return _droppedCommands; }
+
+private:
+    void commandTask();
+    void processCommand(uint8_t const command[], size_t length);
+
+    void connect(IXcpTransport& transport, uint8_t const command[], size_t length);
+    void getStatus();
+    void getCommModeInfo();
+    void setMta(uint8_t const command[], size_t length);
+    void upload(uint8_t const command[], size_t length, bool isShort);
+    void download(uint8_t const command[], size_t length);
+    void getDaqClock();
+    void getDaqProcessorInfo();
+    void getDaqResolutionInfo();
+    void getDaqEventInfo(uint8_t const command[], size_t length);
+    void freeDaq();
+    void allocDaq(uint8_t const command[], size_t length);
+    void allocOdt(uint8_t const command[], size_t length);
+    void allocOdtEntry(uint8_t const command[], size_t length);
+    void setDaqPtr(uint8_t const command[], size_t length);
+    void writeDaq(uint8_t const command[], size_t length);
+    void setDaqListMode(uint8_t const command[], size_t length);
+    void getDaqListMode(uint8_t const command[], size_t length);
+    void startStopDaqList(uint8_t const command[], size_t length);
+    void startStopSynch(uint8_t const command[], size_t length);
+
+    /**
+     * Resolves an address of the master to memory of a region.
+     * \return error code, 0 if the access is allowed
+     */
+    uint8_t resolve(
+        uint8_t extension, uint32_t address, size_t size, bool write, uint8_t*& memory) const;
+
+    /** \return error code, 0 if the DAQ list can be started */
+    uint8_t compile(DaqList const& daqList);
+    void startDaqList(DaqList& daqList);
+    void stopDaqList(DaqList& daqList);
+    void stopAllDaqLists();
+
+    void sendResponse(size_t length);
+    void sendError(uint8_t error);
+
+    ::async::ContextType const _context;
+    ::etl::span<XcpMemoryRegion const> _regions;
+    ::etl::span<XcpEventChannel const> _events;
+    ::etl::span<EventStatistics> _statistics;
+    ::etl::span<DaqList> _daqLists;
+    ::etl::span<Odt> _odts;
+    ::etl::span<OdtEntry> _entries;
+    ::etl::span<GatherSegment> _segments;
+    ::async::Function _commandTask;
+    IXcpTransport* _transport;
+    IXcpTransport* _commandTransport;
+    uint8_t _command[MAX_CTO];
+    size_t _commandLength;
+    bool _commandPending;
+    uint8_t _response[MAX_CTO];
+    uint8_t* _mta;
+    size_t _mtaSize;
+    bool _mtaWritable;
+    size_t _daqCount;
+    size_t _odtCount;
+    size_t _entryCount;
+    size_t _daqPtrEntry;
+    size_t _daqPtrEnd;
+    size_t _runningCount;
+    uint32_t _droppedCommands;
+    uint32_t _statisticsStartMs;
+};
+
+namespace declare
+{
+template<size_t EventCount, size_t DaqListCount, size_t OdtCount, size_t EntryCount>
+class XcpSlave : public ::xcp::XcpSlave
+{
+    static_assert(OdtCount <= ::xcp::XcpSlave::MAX_ODT_COUNT, "too many ODTs");
+
+public:
+    XcpSlave(
+        ::async::ContextType const context,
+        ::etl::span<XcpMemoryRegion const> const regions,
+        XcpEventChannel const (&events)[EventCount])
+    : ::xcp::XcpSlave(
+        context, regions, events, _statistics, _daqLists, _odts, _entries, _segments)
+    , _statistics()
+    , _daqLists()
+    , _odts()
+    , _entries()
+    , _segments()
+    {}
+
+private:
+    EventStatistics _statistics[EventCount];
+    DaqList _daqLists[DaqListCount];
+    Odt _odts[OdtCount];
+    OdtEntry _entries[EntryCount];
+    GatherSegment _segments[EntryCount];
+};
+
+} // namespace declare
+
+} // namespace xcp
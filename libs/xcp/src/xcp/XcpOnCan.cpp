@@ -0,0 +1,87 @@
+// Copyright 2025 Accenture.
+
+#include "xcp/XcpOnCan.h"
+
+#include "xcp/XcpSlave.h"
+
+#include <can/transceiver/ZephyrCanTransceiver.h>
+
+namespace
+{
+uint8_t const MAX_PACKET_LENGTH = 8U;
+}
+
+namespace xcp
+{
+size_t const XcpOnCan::MAX_BATCH_SIZE;
+
+XcpOnCan::XcpOnCan(XcpSlave& slave, uint32_t const croId, uint32_t const dtoId)
+: _slave(slave)
+, _transceiver(nullptr)
+, _filter(croId, croId)
+, _dtoId(dtoId)
+, _frames()
+, _frameCount(0U)
+, _txFailures(0U)
+{}
+
+void XcpOnCan::start(::bios::ZephyrCanTransceiver& transceiver)
+{
+    _transceiver = &transceiver;
+    transceiver.addCANFrameListener(*this);
+}
+
+void XcpOnCan::stop()
+{
+    if (_transceiver != nullptr)
+    {
+        _transceiver->removeCANFrameListener(*this);
+        _transceiver = nullptr;
+    }
+    _frameCount = 0U;
+}
+
+uint8_t XcpOnCan::getMaxCto() const { return MAX_PACKET_LENGTH; }
+
+uint16_t XcpOnCan::getMaxDto() const { return MAX_PACKET_LENGTH; }
+
+uint8_t* XcpOnCan::allocatePacket(uint16_t const maxLength)
+{
+    if ((maxLength > MAX_PACKET_LENGTH) || (_transceiver == nullptr))
+    {
+        return nullptr;
+    }
+    if (_frameCount == MAX_BATCH_SIZE)
+    {
+        flush();
+    }
+    return _frames[_frameCount].getPayload();
+}
+
+void XcpOnCan::commitPacket(uint16_t const length)
+{
+    ::can::CANFrame& frame = _frames[_frameCount];
+    frame.setId(_dtoId);
+    frame.setPayloadLength(static_cast<uint8_t>(length));
+    ++_frameCount;
+}
+
+void XcpOnCan::flush()
+{
+    if (_frameCount == 0U)
+    {
+        return;
+    }
+    size_t const sent = _transceiver->write(
+        ::etl::span<::can::CANFrame const>(_frames, _frameCount),
+        ::etl::span<::can::ICanTransceiver::ErrorCode>());
+    _txFailures += static_cast<uint32_t>(_frameCount - sent);
+    _frameCount = 0U;
+}
+
+void XcpOnCan::frameReceived(::can::CANFrame const& frame)
+{
+    _slave.commandReceived(*this, frame.getPayload(), frame.getPayloadLength());
+}
+
+} // namespace xcp
@@ -0,0 +1,142 @@
+// Copyright 2025 Accenture.
+
+#include "xcp/XcpOnUdp.h"
+
+#include "xcp/XcpSlave.h"
+
+#include <async/Async.h>
+#include <udp/DatagramPacket.h>
+
+namespace
+{
+uint8_t const CMD_CONNECT = 0xFFU;
+}
+
+namespace xcp
+{
+size_t const XcpOnUdp::MAX_DATAGRAM_LENGTH;
+uint8_t const XcpOnUdp::MAX_CTO;
+uint16_t const XcpOnUdp::MAX_DTO;
+size_t const XcpOnUdp::HEADER_LENGTH;
+
+XcpOnUdp::XcpOnUdp(XcpSlave& slave, ::udp::AbstractDatagramSocket& socket)
+: _slave(slave)
+, _socket(socket)
+, _masterAddress()
+, _masterPort(0U)
+, _txCounter(0U)
+, _txLength(0U)
+, _txFailures(0U)
+, _rxBuffer()
+, _txBuffer()
+{}
+
+bool XcpOnUdp::start(uint16_t const port)
+{
+    ::ip::IPAddress const any = ::ip::make_ip4(0U, 0U, 0U, 0U);
+    _socket.setDataListener(this);
+    return _socket.bind(&any, port) == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK;
+}
+
+void XcpOnUdp::stop()
+{
+    _socket.close();
+    {
+        ::async::LockType const lock;
+        _masterPort = 0U;
+    }
+    _txLength = 0U;
+}
+
+uint8_t XcpOnUdp::getMaxCto() const { return MAX_CTO; }
+
+uint16_t XcpOnUdp::getMaxDto() const { return MAX_DTO; }
+
+uint8_t* XcpOnUdp::allocatePacket(uint16_t const maxLength)
+{
+    if ((maxLength > MAX_DTO) || (_masterPort == 0U))
+    {
+        return nullptr;
+    }
+    if ((_txLength + HEADER_LENGTH + maxLength) > MAX_DATAGRAM_LENGTH)
+    {
+        flush();
+    }
+    return &_txBuffer[_txLength + HEADER_LENGTH];
+}
+
+void XcpOnUdp::commitPacket(uint16_t const length)
+{
+    uint8_t* const header = &_txBuffer[_txLength];
+    header[0]             = static_cast<uint8_t>(length);
+    header[1]             = static_cast<uint8_t>(length >> 8U);
+    header[2]             = static_cast<uint8_t>(_txCounter);
+    header[3]             = static_cast<uint8_t>(_txCounter >> 8U);
+    ++_txCounter;
+    _txLength += HEADER_LENGTH + length;
+}
+
+void XcpOnUdp::flush()
+{
+    if (_txLength == 0U)
+    {
+        return;
+    }
+    ::ip::IPAddress masterAddress;
+    uint16_t masterPort;
+    {
+        // a CONNECT received in the meantime changes the master
+        ::async::LockType const lock;
+        masterAddress = _masterAddress;
+        masterPort    = _masterPort;
+    }
+    if (_socket.send(::udp::DatagramPacket(&_txBuffer[0U], _txLength, masterAddress, masterPort))
+        != ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
+    {
+        ++_txFailures;
+    }
+    _txLength = 0U;
+}
+
+void XcpOnUdp::dataReceived(
+    ::udp::AbstractDatagramSocket& /*socket*/,
+    ::ip::IPAddress const sourceAddress,
+    uint16_t const sourcePort,
+    ::ip::IPAddress /*destinationAddress*/,
+    uint16_t const length)
+{
+    if (length > sizeof(_rxBuffer))
+    {
+        return;
+    }
+    size_t const received = _socket.read(&_rxBuffer[0U], length);
+    size_t offset         = 0U;
+    while ((offset + HEADER_LENGTH) <= received)
+    {
+        size_t const packetLength = _rxBuffer[offset] | (_rxBuffer[offset + 1U] << 8U);
+        offset += HEADER_LENGTH;
+        if ((packetLength == 0U) || ((offset + packetLength) > received))
+        {
+            break;
+        }
+        // the session belongs to the sender of the last CONNECT, other senders are ignored
+        bool isMaster;
+        {
+            // flush() reads the master in the context of the slave
+            ::async::LockType const lock;
+            if (_rxBuffer[offset] == CMD_CONNECT)
+            {
+                _masterAddress = sourceAddress;
+                _masterPort    = sourcePort;
+            }
+            isMaster = (sourcePort == _masterPort) && (sourceAddress == _masterAddress);
+        }
+        if (isMaster)
+        {
+            _slave.commandReceived(*this, &_rxBuffer[offset], packetLength);
+        }
+        offset += packetLength;
+    }
+}
+
+} // namespace xcp
@@ -0,0 +1,1041 @@
+// Copyright 2025 Accenture.
+
+#include "xcp/XcpSlave.h"
+
+#include <bsp/timer/SystemTimer.h>
+
+#include <zephyr/kernel.h>
+
+#include <cstring>
+
+namespace
+{
+// commands
+uint8_t const CMD_CONNECT                 = 0xFFU;
+uint8_t const CMD_DISCONNECT              = 0xFEU;
+uint8_t const CMD_GET_STATUS              = 0xFDU;
+uint8_t const CMD_SYNCH                   = 0xFCU;
+uint8_t const CMD_GET_COMM_MODE_INFO      = 0xFBU;
+uint8_t const CMD_SET_MTA                 = 0xF6U;
+uint8_t const CMD_UPLOAD                  = 0xF5U;
+uint8_t const CMD_SHORT_UPLOAD            = 0xF4U;
+uint8_t const CMD_DOWNLOAD                = 0xF0U;
+uint8_t const CMD_SET_DAQ_PTR             = 0xE2U;
+uint8_t const CMD_WRITE_DAQ               = 0xE1U;
+uint8_t const CMD_SET_DAQ_LIST_MODE       = 0xE0U;
+uint8_t const CMD_GET_DAQ_LIST_MODE       = 0xDFU;
+uint8_t const CMD_START_STOP_DAQ_LIST     = 0xDEU;
+uint8_t const CMD_START_STOP_SYNCH        = 0xDDU;
+uint8_t const CMD_GET_DAQ_CLOCK           = 0xDCU;
+uint8_t const CMD_GET_DAQ_PROCESSOR_INFO  = 0xDAU;
+uint8_t const CMD_GET_DAQ_RESOLUTION_INFO = 0xD9U;
+uint8_t const CMD_GET_DAQ_EVENT_INFO      = 0xD7U;
+uint8_t const CMD_FREE_DAQ                = 0xD6U;
+uint8_t const CMD_ALLOC_DAQ               = 0xD5U;
+uint8_t const CMD_ALLOC_ODT               = 0xD4U;
+uint8_t const CMD_ALLOC_ODT_ENTRY         = 0xD3U;
+
+// packet identifiers
+uint8_t const PID_RESPONSE = 0xFFU;
+uint8_t const PID_ERROR    = 0xFEU;
+
+// error codes
+uint8_t const ERR_OK              = 0x00U;
+uint8_t const ERR_CMD_SYNCH       = 0x00U;
+uint8_t const ERR_DAQ_ACTIVE      = 0x11U;
+uint8_t const ERR_CMD_UNKNOWN     = 0x20U;
+uint8_t const ERR_CMD_SYNTAX      = 0x21U;
+uint8_t const ERR_OUT_OF_RANGE    = 0x22U;
+uint8_t const ERR_WRITE_PROTECTED = 0x23U;
+uint8_t const ERR_ACCESS_DENIED   = 0x24U;
+uint8_t const ERR_MODE_NOT_VALID  = 0x27U;
+uint8_t const ERR_SEQUENCE        = 0x29U;
+uint8_t const ERR_DAQ_CONFIG      = 0x2AU;
+uint8_t const ERR_MEMORY_OVERFLOW = 0x30U;
+
+// CONNECT: DAQ resource, Intel byte order, GET_COMM_MODE_INFO supported
+uint8_t const RESOURCE_DAQ               = 0x04U;
+uint8_t const COMM_MODE_BASIC            = 0x80U;
+uint8_t const PROTOCOL_LAYER_VERSION     = 0x01U;
+uint8_t const TRANSPORT_LAYER_VERSION    = 0x01U;
+uint8_t const DRIVER_VERSION             = 0x10U;
+uint8_t const SESSION_STATUS_DAQ_RUNNING = 0x40U;
+
+// DAQ list modes
+uint8_t const DAQ_MODE_SELECTED  = 0x01U;
+uint8_t const DAQ_MODE_DIRECTION = 0x02U;
+uint8_t const DAQ_MODE_TIMESTAMP = 0x10U;
+uint8_t const DAQ_MODE_PID_OFF   = 0x20U;
+uint8_t const DAQ_MODE_RUNNING   = 0x40U;
+
+// dynamic configuration, prescaler and timestamps supported
+uint8_t const DAQ_PROPERTIES      = 0x13U;
+uint8_t const DAQ_EVENT_PROPERTY  = 0x04U;
+uint8_t const EVENT_TIME_UNIT_1MS = 0x06U;
+// 4 byte timestamps with a unit of 1 us
+uint8_t const TIMESTAMP_MODE      = 0x34U;
+uint8_t const TIMESTAMP_SIZE      = 4U;
+uint8_t const BIT_OFFSET_UNUSED   = 0xFFU;
+
+uint16_t getWord(uint8_t const data[])
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << 8U));
+}
+
+uint32_t getDword(uint8_t const data[])
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8U)
+           | (static_cast<uint32_t>(data[2]) << 16U) | (static_cast<uint32_t>(data[3]) << 24U);
+}
+
+void setWord(uint8_t data[], uint16_t const value)
+{
+    data[0] = static_cast<uint8_t>(value);
+    data[1] = static_cast<uint8_t>(value >> 8U);
+}
+
+void setDword(uint8_t data[], uint32_t const value)
+{
+    data[0] = static_cast<uint8_t>(value);
+    data[1] = static_cast<uint8_t>(value >> 8U);
+    data[2] = static_cast<uint8_t>(value >> 16U);
+    data[3] = static_cast<uint8_t>(value >> 24U);
+}
+
+} // namespace
+
+namespace xcp
+{
+uint8_t const XcpSlave::MAX_CTO;
+size_t const XcpSlave::MAX_ODT_COUNT;
+
+XcpSlave::XcpSlave(
+    ::async::ContextType const context,
+    ::etl::span<XcpMemoryRegion const> const regions,
+    ::etl::span<XcpEventChannel const> const events,
+    ::etl::span<EventStatistics> const statistics,
+    ::etl::span<DaqList> const daqLists,
+    ::etl::span<Odt> const odts,
+    ::etl::span<OdtEntry> const entries,
+    ::etl::span<GatherSegment> const segments)
+: _context(context)
+, _regions(regions)
+, _events(events)
+, _statistics(statistics)
+, _daqLists(daqLists)
+, _odts(odts)
+, _entries(entries)
+, _segments(segments)
+, _commandTask(::async::Function::CallType::create<XcpSlave, &XcpSlave::commandTask>(*this))
+, _transport(nullptr)
+, _commandTransport(nullptr)
+, _command()
+, _commandLength(0U)
+, _commandPending(false)
+, _response()
+, _mta(nullptr)
+, _mtaSize(0U)
+, _mtaWritable(false)
+, _daqCount(0U)
+, _odtCount(0U)
+, _entryCount(0U)
+, _daqPtrEntry(0U)
+, _daqPtrEnd(0U)
+, _runningCount(0U)
+, _droppedCommands(0U)
+, _statisticsStartMs(0U)
+{}
+
+void XcpSlave::commandReceived(
+    IXcpTransport& transport, uint8_t const data[], size_t const length)
+{
+    {
+        ::async::LockType const lock;
+        if (_commandPending || (length == 0U) || (length > MAX_CTO))
+        {
+            ++_droppedCommands;
+            return;
+        }
+        _commandPending = true;
+    }
+    (void)memcpy(_command, data, length);
+    _commandLength    = length;
+    _commandTransport = &transport;
+    ::async::execute(_context, _commandTask);
+}
+
+void XcpSlave::commandTask()
+{
+    IXcpTransport& transport = *_commandTransport;
+    if (_command[0] == CMD_CONNECT)
+    {
+        connect(transport, _command, _commandLength);
+    }
+    else if (&transport == _transport)
+    {
+        processCommand(_command, _commandLength);
+    }
+    else
+    {
+        // not connected or connected through another transport: no response
+    }
+    ::async::LockType const lock;
+    _commandPending = false;
+}
+
+void XcpSlave::processCommand(uint8_t const command[], size_t const length)
+{
+    switch (command[0])
+    {
+        case CMD_DISCONNECT:
+        {
+            _response[0] = PID_RESPONSE;
+            sendResponse(1U);
+            disconnect();
+            break;
+        }
+        case CMD_GET_STATUS:
+        {
+            getStatus();
+            break;
+        }
+        case CMD_SYNCH:
+        {
+            sendError(ERR_CMD_SYNCH);
+            break;
+        }
+        case CMD_GET_COMM_MODE_INFO:
+        {
+            getCommModeInfo();
+            break;
+        }
+        case CMD_SET_MTA:
+        {
+            setMta(command, length);
+            break;
+        }
+        case CMD_UPLOAD:
+        {
+            upload(command, length, false);
+            break;
+        }
+        case CMD_SHORT_UPLOAD:
+        {
+            upload(command, length, true);
+            break;
+        }
+        case CMD_DOWNLOAD:
+        {
+            download(command, length);
+            break;
+        }
+        case CMD_GET_DAQ_CLOCK:
+        {
+            getDaqClock();
+            break;
+        }
+        case CMD_GET_DAQ_PROCESSOR_INFO:
+        {
+            getDaqProcessorInfo();
+            break;
+        }
+        case CMD_GET_DAQ_RESOLUTION_INFO:
+        {
+            getDaqResolutionInfo();
+            break;
+        }
+        case CMD_GET_DAQ_EVENT_INFO:
+        {
+            getDaqEventInfo(command, length);
+            break;
+        }
+        case CMD_FREE_DAQ:
+        {
+            freeDaq();
+            break;
+        }
+        case CMD_ALLOC_DAQ:
+        {
+            allocDaq(command, length);
+            break;
+        }
+        case CMD_ALLOC_ODT:
+        {
+            allocOdt(command, length);
+            break;
+        }
+        case CMD_ALLOC_ODT_ENTRY:
+        {
+            allocOdtEntry(command, length);
+            break;
+        }
+        case CMD_SET_DAQ_PTR:
+        {
+            setDaqPtr(command, length);
+            break;
+        }
+        case CMD_WRITE_DAQ:
+        {
+            writeDaq(command, length);
+            break;
+        }
+        case CMD_SET_DAQ_LIST_MODE:
+        {
+            setDaqListMode(command, length);
+            break;
+        }
+        case CMD_GET_DAQ_LIST_MODE:
+        {
+            getDaqListMode(command, length);
+            break;
+        }
+        case CMD_START_STOP_DAQ_LIST:
+        {
+            startStopDaqList(command, length);
+            break;
+        }
+        case CMD_START_STOP_SYNCH:
+        {
+            startStopSynch(command, length);
+            break;
+        }
+        default:
+        {
+            sendError(ERR_CMD_UNKNOWN);
+            break;
+        }
+    }
+}
+
+void XcpSlave::connect(IXcpTransport& transport, uint8_t const[], size_t const length)
+{
+    if (length < 2U)
+    {
+        return;
+    }
+    if ((_transport != nullptr) && (&transport != _transport))
+    {
+        // the session moves to the new transport
+        disconnect();
+    }
+    _transport        = &transport;
+    uint8_t const cto = (transport.getMaxCto() < MAX_CTO) ? transport.getMaxCto() : MAX_CTO;
+    _response[0]      = PID_RESPONSE;
+    _response[1]      = RESOURCE_DAQ;
+    _response[2]      = COMM_MODE_BASIC;
+    _response[3]      = cto;
+    setWord(&_response[4], transport.getMaxDto());
+    _response[6] = PROTOCOL_LAYER_VERSION;
+    _response[7] = TRANSPORT_LAYER_VERSION;
+    sendResponse(8U);
+}
+
+void XcpSlave::disconnect()
+{
+    stopAllDaqLists();
+    _transport = nullptr;
+    _mta       = nullptr;
+    _mtaSize   = 0U;
+}
+
+void XcpSlave::getStatus()
+{
+    _response[0] = PID_RESPONSE;
+    _response[1] = (_runningCount > 0U) ? SESSION_STATUS_DAQ_RUNNING : 0U;
+    _response[2] = 0U;
+    _response[3] = 0U;
+    setWord(&_response[4], 0U);
+    sendResponse(6U);
+}
+
+void XcpSlave::getCommModeInfo()
+{
+    _response[0] = PID_RESPONSE;
+    _response[1] = 0U;
+    _response[2] = 0U;
+    _response[3] = 0U;
+    _response[4] = 0U;
+    _response[5] = 0U;
+    _response[6] = 0U;
+    _response[7] = DRIVER_VERSION;
+    sendResponse(8U);
+}
+
+void XcpSlave::setMta(uint8_t const command[], size_t const length)
+{
+    if (length < 8U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    uint8_t const extension = command[3];
+    uint32_t const address  = getDword(&command[4]);
+    uint8_t* memory         = nullptr;
+    uint8_t const error     = resolve(extension, address, 0U, false, memory);
+    if (error != ERR_OK)
+    {
+        sendError(error);
+        return;
+    }
+    XcpMemoryRegion const& region = _regions[extension];
+    _mta                          = memory;
+    _mtaSize                      = region._size - address;
+    _mtaWritable                  = region._writable;
+    _response[0]                  = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::upload(uint8_t const command[], size_t const length, bool const isShort)
+{
+    if (length < (isShort ? 8U : 2U))
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const size = command[1];
+    if ((size == 0U) || (size >= _transport->getMaxCto()) || (size >= MAX_CTO))
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    uint8_t const* source = nullptr;
+    if (isShort)
+    {
+        uint8_t* memory     = nullptr;
+        uint8_t const error = resolve(command[3], getDword(&command[4]), size, false, memory);
+        if (error != ERR_OK)
+        {
+            sendError(error);
+            return;
+        }
+        source = memory;
+    }
+    else
+    {
+        if ((_mta == nullptr) || (size > _mtaSize))
+        {
+            sendError(ERR_ACCESS_DENIED);
+            return;
+        }
+        source = _mta;
+        _mta += size;
+        _mtaSize -= size;
+    }
+    _response[0] = PID_RESPONSE;
+    (void)memcpy(&_response[1], source, size);
+    sendResponse(1U + size);
+}
+
+void XcpSlave::download(uint8_t const command[], size_t const length)
+{
+    if (length < 2U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const size = command[1];
+    if ((size == 0U) || ((size + 2U) > length))
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    if ((_mta == nullptr) || (size > _mtaSize))
+    {
+        sendError(ERR_ACCESS_DENIED);
+        return;
+    }
+    if (!_mtaWritable)
+    {
+        sendError(ERR_WRITE_PROTECTED);
+        return;
+    }
+    (void)memcpy(_mta, &command[2], size);
+    _mta += size;
+    _mtaSize -= size;
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::getDaqClock()
+{
+    _response[0] = PID_RESPONSE;
+    _response[1] = 0U;
+    _response[2] = 0U;
+    _response[3] = 0U;
+    setDword(&_response[4], getSystemTimeUs32Bit());
+    sendResponse(8U);
+}
+
+void XcpSlave::getDaqProcessorInfo()
+{
+    _response[0] = PID_RESPONSE;
+    _response[1] = DAQ_PROPERTIES;
+    setWord(&_response[2], static_cast<uint16_t>(_daqLists.size()));
+    setWord(&_response[4], static_cast<uint16_t>(_events.size()));
+    // no predefined lists, address extension may differ per entry, absolute ODT numbers
+    _response[6] = 0U;
+    _response[7] = 0U;
+    sendResponse(8U);
+}
+
+void XcpSlave::getDaqResolutionInfo()
+{
+    size_t const maxEntrySize = _transport->getMaxDto() - 1U;
+    _response[0]              = PID_RESPONSE;
+    _response[1]              = 1U;
+    _response[2] = (maxEntrySize > 0xFFU) ? 0xFFU : static_cast<uint8_t>(maxEntrySize);
+    _response[3] = 1U;
+    _response[4] = 0U;
+    _response[5] = TIMESTAMP_MODE;
+    setWord(&_response[6], 1U);
+    sendResponse(8U);
+}
+
+void XcpSlave::getDaqEventInfo(uint8_t const command[], size_t const length)
+{
+    if (length < 4U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const channel = getWord(&command[2]);
+    if (channel >= _events.size())
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    _response[0] = PID_RESPONSE;
+    _response[1] = DAQ_EVENT_PROPERTY;
+    _response[2] = 0xFFU;
+    // the name is not provided, it would have to be uploaded through the MTA
+    _response[3] = 0U;
+    _response[4] = _events[channel]._cycleMs;
+    _response[5] = EVENT_TIME_UNIT_1MS;
+    _response[6] = 0U;
+    sendResponse(7U);
+}
+
+void XcpSlave::freeDaq()
+{
+    stopAllDaqLists();
+    _daqCount    = 0U;
+    _odtCount    = 0U;
+    _entryCount  = 0U;
+    _daqPtrEntry = 0U;
+    _daqPtrEnd   = 0U;
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::allocDaq(uint8_t const command[], size_t const length)
+{
+    if (length < 4U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const count = getWord(&command[2]);
+    if ((_daqCount != 0U) || (_odtCount != 0U))
+    {
+        sendError(ERR_SEQUENCE);
+        return;
+    }
+    if (count > _daqLists.size())
+    {
+        sendError(ERR_MEMORY_OVERFLOW);
+        return;
+    }
+    for (size_t i = 0U; i < count; ++i)
+    {
+        DaqList& daqList   = _daqLists[i];
+        daqList            = DaqList();
+        daqList._prescaler = 1U;
+    }
+    _daqCount    = count;
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::allocOdt(uint8_t const command[], size_t const length)
+{
+    if (length < 5U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const daq   = getWord(&command[2]);
+    size_t const count = command[4];
+    if ((_entryCount != 0U) || ((daq < _daqCount) && (_daqLists[daq]._odtCount != 0U)))
+    {
+        sendError(ERR_SEQUENCE);
+        return;
+    }
+    if (daq >= _daqCount)
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    if ((_odtCount + count) > _odts.size())
+    {
+        sendError(ERR_MEMORY_OVERFLOW);
+        return;
+    }
+    DaqList& daqList  = _daqLists[daq];
+    daqList._firstOdt = static_cast<uint16_t>(_odtCount);
+    daqList._odtCount = static_cast<uint8_t>(count);
+    for (size_t i = 0U; i < count; ++i)
+    {
+        _odts[_odtCount + i] = Odt();
+    }
+    _odtCount += count;
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::allocOdtEntry(uint8_t const command[], size_t const length)
+{
+    if (length < 6U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const daq   = getWord(&command[2]);
+    size_t const odt   = command[4];
+    size_t const count = command[5];
+    if ((daq >= _daqCount) || (odt >= _daqLists[daq]._odtCount))
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    Odt& entryOdt = _odts[_daqLists[daq]._firstOdt + odt];
+    if (entryOdt._entryCount != 0U)
+    {
+        sendError(ERR_SEQUENCE);
+        return;
+    }
+    if ((_entryCount + count) > _entries.size())
+    {
+        sendError(ERR_MEMORY_OVERFLOW);
+        return;
+    }
+    entryOdt._firstEntry = static_cast<uint16_t>(_entryCount);
+    entryOdt._entryCount = static_cast<uint8_t>(count);
+    for (size_t i = 0U; i < count; ++i)
+    {
+        _entries[_entryCount + i] = OdtEntry();
+    }
+    _entryCount += count;
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::setDaqPtr(uint8_t const command[], size_t const length)
+{
+    if (length < 6U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const daq   = getWord(&command[2]);
+    size_t const odt   = command[4];
+    size_t const entry = command[5];
+    if ((daq >= _daqCount) || (odt >= _daqLists[daq]._odtCount))
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    Odt const& entryOdt = _odts[_daqLists[daq]._firstOdt + odt];
+    if (entry >= entryOdt._entryCount)
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    // a selected list has been compiled for START_STOP_SYNCH already
+    if (_daqLists[daq]._running || _daqLists[daq]._selected)
+    {
+        sendError(ERR_DAQ_ACTIVE);
+        return;
+    }
+    _daqPtrEntry = entryOdt._firstEntry + entry;
+    _daqPtrEnd   = entryOdt._firstEntry + entryOdt._entryCount;
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::writeDaq(uint8_t const command[], size_t const length)
+{
+    if (length < 8U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const size = command[2];
+    if (_daqPtrEntry >= _daqPtrEnd)
+    {
+        sendError(ERR_SEQUENCE);
+        return;
+    }
+    if ((command[1] != BIT_OFFSET_UNUSED) || (size == 0U) || (size >= _transport->getMaxDto()))
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    uint8_t* memory     = nullptr;
+    uint8_t const error = resolve(command[3], getDword(&command[4]), size, false, memory);
+    if (error != ERR_OK)
+    {
+        sendError(error);
+        return;
+    }
+    OdtEntry& entry = _entries[_daqPtrEntry];
+    entry._source   = memory;
+    entry._size     = static_cast<uint8_t>(size);
+    ++_daqPtrEntry;
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::setDaqListMode(uint8_t const command[], size_t const length)
+{
+    if (length < 8U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    uint8_t const mode   = command[1];
+    size_t const daq     = getWord(&command[2]);
+    size_t const channel = getWord(&command[4]);
+    if ((daq >= _daqCount) || (channel >= _events.size()) || (command[6] == 0U))
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    if ((mode & (DAQ_MODE_DIRECTION | DAQ_MODE_PID_OFF)) != 0U)
+    {
+        // STIM and DTOs without identification field are not supported
+        sendError(ERR_MODE_NOT_VALID);
+        return;
+    }
+    DaqList& daqList = _daqLists[daq];
+    // a selected list has been compiled for START_STOP_SYNCH with its mode already
+    if (daqList._running || daqList._selected)
+    {
+        sendError(ERR_DAQ_ACTIVE);
+        return;
+    }
+    daqList._mode             = mode & DAQ_MODE_TIMESTAMP;
+    daqList._eventChannel     = static_cast<uint16_t>(channel);
+    daqList._prescaler        = command[6];
+    daqList._prescalerCounter = 0U;
+    daqList._priority         = command[7];
+    _response[0]              = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+void XcpSlave::getDaqListMode(uint8_t const command[], size_t const length)
+{
+    if (length < 4U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    size_t const daq = getWord(&command[2]);
+    if (daq >= _daqCount)
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    DaqList const& daqList = _daqLists[daq];
+    _response[0]           = PID_RESPONSE;
+    _response[1]           = daqList._mode | (daqList._selected ? DAQ_MODE_SELECTED : 0U)
+                   | (daqList._running ? DAQ_MODE_RUNNING : 0U);
+    _response[2] = 0U;
+    _response[3] = 0U;
+    setWord(&_response[4], daqList._eventChannel);
+    _response[6] = daqList._prescaler;
+    _response[7] = daqList._priority;
+    sendResponse(8U);
+}
+
+void XcpSlave::startStopDaqList(uint8_t const command[], size_t const length)
+{
+    if (length < 4U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    uint8_t const mode = command[1];
+    size_t const daq   = getWord(&command[2]);
+    if ((daq >= _daqCount) || (mode > 2U))
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    DaqList& daqList = _daqLists[daq];
+    if (mode != 0U)
+    {
+        uint8_t const error = compile(daqList);
+        if (error != ERR_OK)
+        {
+            sendError(error);
+            return;
+        }
+        // WRITE_DAQ must not change the compiled list, it needs a new SET_DAQ_PTR
+        _daqPtrEntry = _daqPtrEnd;
+    }
+    if (mode == 0U)
+    {
+        stopDaqList(daqList);
+    }
+    else if (mode == 1U)
+    {
+        startDaqList(daqList);
+    }
+    else
+    {
+        daqList._selected = true;
+    }
+    _response[0] = PID_RESPONSE;
+    _response[1] = static_cast<uint8_t>(daqList._firstOdt);
+    sendResponse(2U);
+}
+
+void XcpSlave::startStopSynch(uint8_t const command[], size_t const length)
+{
+    if (length < 2U)
+    {
+        sendError(ERR_CMD_SYNTAX);
+        return;
+    }
+    uint8_t const mode = command[1];
+    if (mode > 2U)
+    {
+        sendError(ERR_OUT_OF_RANGE);
+        return;
+    }
+    if (mode == 0U)
+    {
+        stopAllDaqLists();
+    }
+    else
+    {
+        for (size_t i = 0U; i < _daqCount; ++i)
+        {
+            DaqList& daqList = _daqLists[i];
+            if (daqList._selected)
+            {
+                daqList._selected = false;
+                if (mode == 1U)
+                {
+                    startDaqList(daqList);
+                }
+                else
+                {
+                    stopDaqList(daqList);
+                }
+            }
+        }
+    }
+    _response[0] = PID_RESPONSE;
+    sendResponse(1U);
+}
+
+uint8_t XcpSlave::resolve(
+    uint8_t const extension,
+    uint32_t const address,
+    size_t const size,
+    bool const write,
+    uint8_t*& memory) const
+{
+    if (extension >= _regions.size())
+    {
+        return ERR_ACCESS_DENIED;
+    }
+    XcpMemoryRegion const& region = _regions[extension];
+    if ((address > region._size) || (size > (region._size - address)))
+    {
+        return ERR_ACCESS_DENIED;
+    }
+    if (write && !region._writable)
+    {
+        return ERR_WRITE_PROTECTED;
+    }
+    memory = region._base + address;
+    return ERR_OK;
+}
+
+uint8_t XcpSlave::compile(DaqList const& daqList)
+{
+    if (daqList._odtCount == 0U)
+    {
+        return ERR_DAQ_CONFIG;
+    }
+    size_t const maxDto = _transport->getMaxDto();
+    for (size_t i = 0U; i < daqList._odtCount; ++i)
+    {
+        Odt& odt = _odts[daqList._firstOdt + i];
+        bool const hasTimestamp = (i == 0U) && ((daqList._mode & DAQ_MODE_TIMESTAMP) != 0U);
+        size_t length           = 1U + (hasTimestamp ? TIMESTAMP_SIZE : 0U);
+        size_t segmentCount     = 0U;
+        GatherSegment* last     = nullptr;
+        for (size_t e = 0U; e < odt._entryCount; ++e)
+        {
+            OdtEntry const& entry = _entries[odt._firstEntry + e];
+            if (entry._source == nullptr)
+            {
+                return ERR_DAQ_CONFIG;
+            }
+            length += entry._size;
+            if ((last != nullptr) && ((last->_source + last->_length) == entry._source))
+            {
+                // adjacent to the previous entry, e.g. consecutive members of a struct
+                last->_length += entry._size;
+            }
+            else
+            {
+                last          = &_segments[odt._firstEntry + segmentCount];
+                last->_source = entry._source;
+                last->_length = entry._size;
+                ++segmentCount;
+            }
+        }
+        if (length > maxDto)
+        {
+            return ERR_DAQ_CONFIG;
+        }
+        odt._segmentCount = static_cast<uint8_t>(segmentCount);
+        odt._length       = static_cast<uint16_t>(length);
+    }
+    return ERR_OK;
+}
+
+void XcpSlave::startDaqList(DaqList& daqList)
+{
+    if (!daqList._running)
+    {
+        daqList._running          = true;
+        daqList._prescalerCounter = 0U;
+        ++_runningCount;
+    }
+}
+
+void XcpSlave::stopDaqList(DaqList& daqList)
+{
+    daqList._selected = false;
+    if (daqList._running)
+    {
+        daqList._running = false;
+        --_runningCount;
+    }
+}
+
+void XcpSlave::stopAllDaqLists()
+{
+    for (size_t i = 0U; i < _daqCount; ++i)
+    {
+        stopDaqList(_daqLists[i]);
+    }
+}
+
+void XcpSlave::event(size_t const channel)
+{
+    if ((_runningCount == 0U) || (channel >= _events.size()))
+    {
+        return;
+    }
+    uint32_t const start     = k_cycle_get_32();
+    uint32_t const timestamp = getSystemTimeUs32Bit();
+    EventStatistics& stats   = _statistics[channel];
+    bool sampled             = false;
+    for (size_t i = 0U; i < _daqCount; ++i)
+    {
+        DaqList& daqList = _daqLists[i];
+        if ((!daqList._running) || (daqList._eventChannel != channel))
+        {
+            continue;
+        }
+        ++daqList._prescalerCounter;
+        if (daqList._prescalerCounter < daqList._prescaler)
+        {
+            continue;
+        }
+        daqList._prescalerCounter = 0U;
+        sampled                   = true;
+        for (size_t o = 0U; o < daqList._odtCount; ++o)
+        {
+            size_t const pid = daqList._firstOdt + o;
+            Odt const& odt   = _odts[pid];
+            uint8_t* packet  = _transport->allocatePacket(odt._length);
+            if (packet == nullptr)
+            {
+                ++stats._overruns;
+                continue;
+            }
+            *packet = static_cast<uint8_t>(pid);
+            ++packet;
+            if ((o == 0U) && ((daqList._mode & DAQ_MODE_TIMESTAMP) != 0U))
+            {
+                setDword(packet, timestamp);
+                packet += TIMESTAMP_SIZE;
+            }
+            GatherSegment const* segment = &_segments[odt._firstEntry];
+            GatherSegment const* end     = segment + odt._segmentCount;
+            for (; segment != end; ++segment)
+            {
+                (void)memcpy(packet, segment->_source, segment->_length);
+                packet += segment->_length;
+            }
+            _transport->commitPacket(odt._length);
+            ++stats._odts;
+            stats._entries += odt._entryCount;
+            stats._bytes += odt._length;
+        }
+    }
+    if (!sampled)
+    {
+        return;
+    }
+    _transport->flush();
+    uint32_t const cycles = k_cycle_get_32() - start;
+    ++stats._samples;
+    stats._cycles += cycles;
+    if (cycles > stats._maxCycles)
+    {
+        stats._maxCycles = cycles;
+    }
+}
+
+uint32_t XcpSlave::getStatisticsAgeMs() const
+{
+    return getSystemTimeMs32Bit() - _statisticsStartMs;
+}
+
+void XcpSlave::resetStatistics()
+{
+    for (size_t i = 0U; i < _statistics.size(); ++i)
+    {
+        _statistics[i] = EventStatistics();
+    }
+    _statisticsStartMs = getSystemTimeMs32Bit();
+}
+
+void XcpSlave::sendResponse(size_t const length)
+{
+    uint8_t* const packet = _transport->allocatePacket(static_cast<uint16_t>(length));
+    if (packet == nullptr)
+    {
+        return;
+    }
+    (void)memcpy(packet, _response, length);
+    _transport->commitPacket(static_cast<uint16_t>(length));
+    _transport->flush();
+}
+
+void XcpSlave::sendError(uint8_t const error)
+{
+    _response[0] = PID_ERROR;
+    _response[1] = error;
+    sendResponse(2U);
+}
+
+} // namespace xcp
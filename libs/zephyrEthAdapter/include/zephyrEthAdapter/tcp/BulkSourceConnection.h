@@ -0,0 +1,54 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <tcp/IDataListener.h>
+#include <tcp/IDataSendNotificationListener.h>
+#include <zephyrEthAdapter/tcp/ZephyrConnectionPool.h>
+#include <zephyrEthAdapter/tcp/ZephyrSocket.h>
+
+#include <platform/estdint.h>
+
+namespace tcp
+{
+/**
+ * Sends a counting byte pattern on one connection of a ZephyrConnectionPool as fast as the
+ * socket takes it, e.g. as background load next to latency sensitive connections. Received
+ * data is discarded. The send buffer of the socket is refilled in chunks of CHUNK_LENGTH
+ * whenever it has room, see dataSent().
+ */
+class BulkSourceConnection
+: public IConnectionHandler
+, public IDataListener
+, public IDataSendNotificationListener
+{
+public:
+    static size_t const CHUNK_LENGTH     = 512U;
+    static size_t const SEND_BUFFER_SIZE = 4096U;
+
+    BulkSourceConnection();
+
+    BulkSourceConnection(BulkSourceConnection const&)            = delete;
+    BulkSourceConnection& operator=(BulkSourceConnection const&) = delete;
+
+    void connectionAccepted(ZephyrSocket& socket) override;
+
+    void dataReceived(uint16_t length) override;
+
+    void connectionClosed(ErrorCode status) override;
+
+    void dataSent(uint16_t length, SendResult result) override;
+
+    /** \return bytes sent since the connection was accepted */
+    uint32_t getSentLength() const { return _sent; }
+
+private:
+    void fill();
+
+    ZephyrSocket* _socket;
+    uint32_t _sent;
+    uint8_t _chunk[CHUNK_LENGTH];
+    uint8_t _sendBuffer[SEND_BUFFER_SIZE];
+};
+
+} // namespace tcp
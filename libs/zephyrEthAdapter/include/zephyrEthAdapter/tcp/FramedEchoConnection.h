@@ -0,0 +1,61 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <tcp/IDataListener.h>
+#include <tcp/IDataSendNotificationListener.h>
+#include <zephyrEthAdapter/tcp/ZephyrConnectionPool.h>
+#include <zephyrEthAdapter/tcp/ZephyrSocket.h>
+
+#include <platform/estdint.h>
+
+namespace tcp
+{
+/**
+ * Echoes the frames of a length-prefixed protocol on one connection of a ZephyrConnectionPool:
+ * a 16 bit big endian payload length followed by the payload.
+ *
+ * Frames are parsed with ZephyrSocket::peek() and consume(), the receive threshold of the
+ * socket is set to the header or to the rest of the frame, so dataReceived() is only called
+ * once a complete unit can be processed. A frame contiguous in one network buffer is echoed
+ * directly from it, other frames are read into a buffer first. Replies go through the send
+ * buffer of the socket, a frame is only consumed once its echo fits in, so a slow peer
+ * throttles the server through the TCP windows instead of losing echoes.
+ */
+class FramedEchoConnection
+: public IConnectionHandler
+, public IDataListener
+, public IDataSendNotificationListener
+{
+public:
+    static size_t const HEADER_LENGTH      = 2U;
+    static size_t const MAX_PAYLOAD_LENGTH = 1024U;
+    static size_t const SEND_BUFFER_SIZE   = 2048U;
+
+    FramedEchoConnection();
+
+    FramedEchoConnection(FramedEchoConnection const&)            = delete;
+    FramedEchoConnection& operator=(FramedEchoConnection const&) = delete;
+
+    void connectionAccepted(ZephyrSocket& socket) override;
+
+    void dataReceived(uint16_t length) override;
+
+    void connectionClosed(ErrorCode status) override;
+
+    void dataSent(uint16_t length, SendResult result) override;
+
+    /** \return frames echoed since the connection was accepted */
+    uint32_t getFrameCount() const { return _frames; }
+
+private:
+    /** \return false if no frame can be echoed now */
+    bool echoFrame();
+
+    ZephyrSocket* _socket;
+    uint32_t _frames;
+    uint8_t _frame[HEADER_LENGTH + MAX_PAYLOAD_LENGTH];
+    uint8_t _sendBuffer[SEND_BUFFER_SIZE];
+};
+
+} // namespace tcp
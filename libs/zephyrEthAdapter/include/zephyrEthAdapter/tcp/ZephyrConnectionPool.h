@@ -0,0 +1,114 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <async/Async.h>
+#include <tcp/socket/ISocketProvidingConnectionListener.h>
+#include <zephyrEthAdapter/tcp/ZephyrSocket.h>
+#include <zephyrEthAdapter/tcp/ZephyrTxScheduler.h>
+
+#include <etl/span.h>
+#include <platform/estdint.h>
+
+namespace tcp
+{
+/**
+ * Serves one connection accepted by a ZephyrConnectionPool.
+ */
+class IConnectionHandler
+{
+public:
+    /**
+     * Called from the RX thread of the network stack when the socket of the handler has been
+     * opened for a new connection. The socket stays with the handler until it is closed.
+     */
+    virtual void connectionAccepted(ZephyrSocket& socket) = 0;
+};
+
+/**
+ * ISocketProvidingConnectionListener serving several connections of a ZephyrServerSocket at
+ * once. Each slot pairs a statically allocated socket with its handler, an accepted connection
+ * gets the first slot whose socket is closed, so one connection doesn't block the others.
+ * A connection closed by the peer is closed in the context of its socket, the slot is only
+ * reused once no notification for the previous connection is queued anymore. A handler must
+ * not use its socket after closing it. Connections arriving while all slots are in use are
+ * rejected.
+ */
+class ZephyrConnectionPool : public ISocketProvidingConnectionListener
+{
+public:
+    struct Slot
+    {
+        ZephyrSocket* _socket;
+        IConnectionHandler* _handler;
+    };
+
+    explicit ZephyrConnectionPool(::etl::span<Slot const> slots);
+
+    ZephyrConnectionPool(ZephyrConnectionPool const&)            = delete;
+    ZephyrConnectionPool& operator=(ZephyrConnectionPool const&) = delete;
+
+    AbstractSocket* getSocket(ip::IPAddress const& ipAddr, uint16_t port) override;
+
+    void connectionAccepted(AbstractSocket& socket) override;
+
+    /** Sets the traffic class of all connections, see ZephyrSocket::setPriority(). */
+    void setPriority(uint8_t priority);
+
+    /**
+     * Adds the sockets of all connections to the scheduler, their handlers must set a send
+     * buffer then.
+     * \return false if the scheduler has no room for all of them
+     */
+    bool setTxScheduler(ZephyrTxScheduler& scheduler);
+
+    size_t getSize() const { return _slots.size(); }
+
+    /** \return number of open connections */
+    size_t getActiveCount() const;
+
+    uint32_t getAcceptedCount() const { return _accepted; }
+
+    /** \return connections rejected because all slots were in use */
+    uint32_t getRejectedCount() const { return _rejected; }
+
+private:
+    ::etl::span<Slot const> _slots;
+    uint32_t _accepted;
+    uint32_t _rejected;
+};
+
+namespace declare
+{
+/**
+ * ZephyrConnectionPool with N sockets and N default constructed handlers of type Handler.
+ */
+template<typename Handler, size_t N>
+class ZephyrConnectionPool : public ::tcp::ZephyrConnectionPool
+{
+public:
+    /**
+     * \param contexts the sockets notify their handlers in these contexts, slot i in
+     *                 contexts[i % contexts.size()], so the connections are spread over them
+     */
+    explicit ZephyrConnectionPool(::etl::span<::async::ContextType const> const contexts)
+    : ::tcp::ZephyrConnectionPool(_slots), _sockets(), _handlers(), _slots()
+    {
+        for (size_t i = 0U; i < N; ++i)
+        {
+            _sockets[i].setContext(contexts[i % contexts.size()]);
+            _slots[i] = Slot{&_sockets[i], &_handlers[i]};
+        }
+    }
+
+    Handler const& getHandler(size_t const index) const { return _handlers[index]; }
+
+private:
+    ZephyrSocket _sockets[N];
+    Handler _handlers[N];
+    Slot _slots[N];
+};
+
+} // namespace declare
+
+} // namespace tcp
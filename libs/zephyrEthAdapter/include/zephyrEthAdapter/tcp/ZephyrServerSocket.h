@@ -51,6 +51,13 @@ public:
 
     bool isClosed() const override;
 
+    /**
+     * Sets the backlog passed to net_context_listen() by accept(), 1 by default. How many
+     * connections are served at once is decided by the providing listener, see
+     * ZephyrConnectionPool, and limited by CONFIG_NET_MAX_CONTEXTS.
+     */
+    void setBacklog(int backlog) { _backlog = backlog; }
+
 private:
     bool createAndBindSocket(ip::IPAddress const& localIpAddress, uint16_t port);
     static void zeth_accepted_cb(struct net_context *new_ctx,
@@ -61,6 +68,7 @@ private:
                     int status);
 
     struct net_context* _netContext;
+    int _backlog;
 };
 
 } // namespace tcp
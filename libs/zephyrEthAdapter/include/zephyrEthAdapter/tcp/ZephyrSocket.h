@@ -4,11 +4,15 @@
 
 #include <zephyr/net/net_context.h>
 #include <zephyr/kernel.h>
+#include <async/Async.h>
+#include <async/util/Call.h>
+#include <etl/span.h>
 #include <ip/IPEndpoint.h>
 #include <ip/IPAddress.h>
 #include <tcp/IDataListener.h>
 #include <tcp/socket/AbstractSocket.h>
 #include <platform/estdint.h>
+#include <zephyrEthAdapter/utils/DeliveryStatistics.h>
 
 extern "C" {
     struct SocketSuspendContext{};
@@ -16,11 +20,18 @@ extern "C" {
         int option,
         const void *value, size_t len);
     int zeth_get_send_data_total(struct net_context *context);
+    int zeth_get_send_window_space(struct net_context *context);
+    int zeth_get_send_window(struct net_context *context);
+    int zeth_tcp_send_all(struct net_context *context,
+        const void *data, size_t len,
+        net_context_send_cb_t cb, void *user_data);
     int zeth_tcp_suspend(struct net_context *context, struct SocketSuspendContext *state);
     struct net_context* zeth_tcp_resume(const struct SocketSuspendContext *state);
 }
 namespace tcp
 {
+class ZephyrTxScheduler;
+
 #define Z_TCP_NODELAY   1
 #define Z_TCP_KEEPALIVE 2
 #define Z_TCP_KEEPIDLE  3
@@ -36,6 +47,13 @@ namespace tcp
 class ZephyrSocket : public AbstractSocket
 {
 public:
+    /** longest peek() gathered into the socket if the bytes aren't contiguous in one buffer */
+    static size_t const MAX_PEEK_LENGTH              = 64U;
+    /** read bytes are given back to the receive window in steps of at least this size */
+    static size_t const RECEIVE_WINDOW_UPDATE_LENGTH = 1024U;
+    /** period in which buffered data the send window didn't take is offered again */
+    static uint32_t const SEND_RETRY_MS              = 1U;
+
     ZephyrSocket();
     ZephyrSocket(ZephyrSocket const&)            = delete;
     ZephyrSocket& operator=(ZephyrSocket const&) = delete;
@@ -84,7 +102,85 @@ public:
 
     void disableKeepAlive() override;
 
+    /**
+     * Returns the next n received bytes without consuming them. The span points into the
+     * network buffer if the bytes are contiguous there, otherwise up to MAX_PEEK_LENGTH bytes
+     * are gathered into the socket. It is valid until the next peek(), consume() or read().
+     * \return empty span if fewer than n bytes are available or they can't be gathered
+     */
+    ::etl::span<uint8_t const> peek(size_t n);
+
+    /**
+     * Consumes n bytes, e.g. a frame examined with peek().
+     * \return number of bytes consumed
+     */
+    size_t consume(size_t n) { return read(nullptr, n); }
+
+    /** \return number of received bytes that have not been read yet */
+    size_t getReceivedLength() const { return _receivedLength; }
+
+    /**
+     * Holds dataReceived() back until at least length unread bytes are available, e.g. the
+     * header or the rest of a frame of a length-prefixed protocol. The notification then
+     * covers all bytes received since the previous one. length must fit into the receive
+     * window, the default is 1.
+     * \return true if length bytes are available already, no notification will follow
+     */
+    bool setReceiveThreshold(size_t length);
+
+    /**
+     * Notifies the data listener in the given context instead of the RX thread of the network
+     * stack. The received packets stay queued in the socket until they are read and the
+     * receive window is only opened by reading, so the queue is bounded by the window and
+     * notifications pending for the context are coalesced into one dataReceived().
+     * A connection closed by the peer is also closed in the context, right before
+     * connectionClosed(), so the listener never sees the socket closed under its hands.
+     */
+    void setContext(::async::ContextType context) { _context = context; }
+
+    /** \return true while a notification for the context is queued */
+    bool isNotificationPending() const;
+
+    ::zethutils::DeliveryStatistics const& getDeliveryStatistics() const
+    {
+        return _deliveryStatistics;
+    }
+
+    void resetDeliveryStatistics();
+
+    /**
+     * Buffers sent data in storage, which must be set before the first send(). send()
+     * only copies the data, with a context set by setContext() the buffer is handed to the
+     * stack once after the current task, so small writes are coalesced into one segment.
+     * What the send window doesn't take stays buffered and is offered again every
+     * SEND_RETRY_MS in the context, or on the next send() or flush() without one.
+     * send() and flush() must be called from the context then.
+     * With a ZephyrTxScheduler the buffer is only handed to the stack as far as the scheduler
+     * grants it. close() drops what is still buffered, call flush() before. If the peer closes
+     * the connection, the buffer is pushed once more in the context before the socket closes.
+     * Without a buffer send() hands all data to the stack or none, it returns
+     * SOCKET_ERR_NO_MORE_BUFFER while the send window is too small and SOCKET_ERR_NOT_OK for
+     * data larger than the whole window, which needs a buffer.
+     */
+    void setSendBuffer(::etl::span<uint8_t> storage) { _sendBuffer = storage; }
+
+    /** \return bytes in the send buffer not taken by the stack yet */
+    size_t getPendingSendLength() const { return _sendCount; }
+
+    /**
+     * Sets the traffic class of the socket, 0 (NET_PRIORITY_BE) by default, up to
+     * NET_MAX_PRIORITIES - 1. It is passed to the net_context with NET_OPT_PRIORITY, if
+     * CONFIG_NET_CONTEXT_PRIORITY is enabled, the stack selects the TX queue of the packets by it
+     * and maps it to the PCP of a VLAN tag. A ZephyrTxScheduler serves the socket by it.
+     * Applies to the current and to later connections.
+     */
+    void setPriority(uint8_t priority);
+
+    uint8_t getPriority() const { return _priority; }
+
 private:
+    friend class ZephyrTxScheduler;
+
     static void zeth_received_cb(struct net_context *ctx,
                   struct net_pkt *pkt,
                   union net_ip_header *ip_hdr,
@@ -106,12 +202,66 @@ private:
 
     void sendCallback(struct net_context *context, int status);
 
+    /** Called from the RX thread, hands the notification over to the context. */
+    void notify(size_t length, bool closed);
+
+    void notificationTask();
+
+    void notifyDataReceived(size_t length);
+
+    /** Gives the bytes read back to the receive window, see RECEIVE_WINDOW_UPDATE_LENGTH. */
+    void updateReceiveWindow(bool force);
+
+    size_t getSendWindowSpace() const;
+    /** \return number of bytes taken by the stack, which may be less than length */
+    size_t sendToStack(uint8_t const* data, size_t length);
+    /** \return result of zeth_tcp_send_all(), the stack takes all data or nothing */
+    int sendAllToStack(uint8_t const* data, size_t length);
+    /**
+     * Hands the send buffer to the stack as far as the send window and, with a scheduler, the
+     * granted length allow.
+     */
+    void push();
+    void pushTask();
+    void pushRetryTask();
+    /** Called by the scheduler from its context. */
+    size_t getUngrantedSendLength() const;
+    /** Called by the scheduler from its context, the data is pushed in the socket context. */
+    void grantSend(size_t length);
+    void applyPriority();
+
     ConnectedDelegate _delegate;
     bool _connecting;
     bool _isAborted;
     struct net_context* _netContext;
     struct k_fifo _receive_q;
-
+    ::async::ContextType _context;
+    /** notifications shared with the RX thread */
+    size_t _pendingLength;
+    uint32_t _pendingPackets;
+    uint32_t _pendingTimestamp;
+    bool _pendingClose;
+    bool _notificationTaskPending;
+    ::async::Function _notificationTask;
+    ::zethutils::DeliveryStatistics _deliveryStatistics;
+    /** unread bytes and bytes not notified yet, shared with the RX thread */
+    size_t _receivedLength;
+    size_t _unnotifiedLength;
+    size_t _receiveThreshold;
+    size_t _windowUpdateLength;
+    uint8_t _peekBuffer[MAX_PEEK_LENGTH];
+    ::etl::span<uint8_t> _sendBuffer;
+    size_t _sendHead;
+    /** shared with the scheduler */
+    size_t _sendCount;
+    size_t _sendCredit;
+    bool _pushTaskPending;
+    bool _pushRetryPending;
+    ::async::Function _pushTask;
+    ::async::Function _pushRetryTask;
+    ::async::TimeoutType _pushRetryTimeout;
+    ZephyrTxScheduler* _scheduler;
+    uint8_t _priority;
 };
 
 } // namespace tcp
@@ -14,6 +14,16 @@ int zeth_net_tcp_set_option(struct net_context *context,
 
 int zeth_get_send_data_total(struct net_context *context);
 
+int zeth_get_send_window_space(struct net_context *context);
+
+/** \return send window of the peer, limited by the congestion window */
+int zeth_get_send_window(struct net_context *context);
+
+/** Queues all data or nothing, \return len or negative error, -EAGAIN if it doesn't fit */
+int zeth_tcp_send_all(struct net_context *context,
+    const void *data, size_t len,
+    net_context_send_cb_t cb, void *user_data);
+
 int zeth_tcp_suspend(struct net_context *context, struct SocketSuspendContext *state);
 
 struct net_context* zeth_tcp_resume(const struct SocketSuspendContext *state);
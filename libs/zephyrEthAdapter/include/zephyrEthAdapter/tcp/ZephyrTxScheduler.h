@@ -0,0 +1,119 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <async/Async.h>
+#include <zephyrEthAdapter/tcp/ZephyrSocket.h>
+
+#include <etl/vector.h>
+#include <platform/estdint.h>
+
+namespace tcp
+{
+/**
+ * Shares the transmit rate of the adapter between the traffic classes of ZephyrSockets with a
+ * send buffer, see ZephyrSocket::setPriority() and setSendBuffer().
+ *
+ * A socket added to the scheduler only hands its send buffer to the stack as far as the
+ * scheduler grants it. Every SCHEDULING_PERIOD_MS the scheduler distributes the bytes the rate
+ * allows in that period between the sockets with pending data, immediately once a socket
+ * becomes pending while it is idle. The stack queues what it gets in order, so without the
+ * scheduler a bulk transfer fills the TX queue of the interface and a small message sent
+ * afterwards waits until the bulk data is out. With the rate slightly below the link rate the
+ * queue stays short and the order is decided by the scheduler:
+ * - FIFO grants everything, like sockets without scheduler
+ * - STRICT serves the classes from the highest priority down, a lower class only gets what the
+ *   higher ones leave. As in IEEE 802.1Q, background (NET_PRIORITY_BK, 1) ranks below best
+ *   effort (NET_PRIORITY_BE, 0), the other priorities rank by their value
+ * - WEIGHTED shares the rate between the pending classes in proportion to their weights, a
+ *   class never starves, what a class leaves goes to the others by priority
+ *
+ * The scheduler runs in its own context, the sockets push the granted data in their contexts,
+ * so each socket must have one, see ZephyrSocket::setContext().
+ */
+class ZephyrTxScheduler
+{
+public:
+    enum class Mode : uint8_t
+    {
+        FIFO,
+        STRICT,
+        WEIGHTED
+    };
+
+    /** the priorities of the zephyr network stack, 0 to NET_MAX_PRIORITIES - 1 */
+    static size_t const CLASS_COUNT            = NET_MAX_PRIORITIES;
+    static size_t const MAX_SOCKETS            = 32U;
+    static uint32_t const SCHEDULING_PERIOD_MS = 1U;
+    /** periods the unused rate is saved up, bounds the burst after an idle time */
+    static uint32_t const MAX_SAVED_PERIODS    = 4U;
+
+    /**
+     * \param bytesPerMs rate shared between the sockets, should be slightly below the
+     *                   rate the interface can send
+     */
+    ZephyrTxScheduler(::async::ContextType context, size_t bytesPerMs);
+
+    ZephyrTxScheduler(ZephyrTxScheduler const&)            = delete;
+    ZephyrTxScheduler& operator=(ZephyrTxScheduler const&) = delete;
+
+    /**
+     * \return false if MAX_SOCKETS sockets have been added or the socket has no context, see
+     *         ZephyrSocket::setContext()
+     */
+    bool add(ZephyrSocket& socket);
+
+    void setMode(Mode mode) { _mode = mode; }
+
+    Mode getMode() const { return _mode; }
+
+    /**
+     * Sets the weight of a class in mode WEIGHTED, the default is its rank + 1, from 1 for
+     * background to NET_MAX_PRIORITIES for the highest priority.
+     */
+    void setWeight(uint8_t priority, uint16_t weight);
+
+    /** \return bytes granted to the sockets of a class */
+    uint32_t getGrantedLength(uint8_t priority) const { return _granted[priority]; }
+
+    /** \return scheduling periods in which pending data exceeded the rate */
+    uint32_t getSaturatedCount() const { return _saturated; }
+
+    void resetStatistics();
+
+    /** Called by a socket with new data to send, from its context. */
+    void wakeUp();
+
+private:
+    void scheduleTask();
+    void periodTask();
+    /** Distributes the budget between the pending sockets according to the mode. */
+    void schedule();
+    /** Adds the rate of the time since the previous call to the budget. */
+    void refill();
+    /** \return bytes granted, at most budget */
+    size_t grantStrict(size_t budget);
+    /** \return bytes granted, at most budget */
+    size_t grantWeighted(size_t budget);
+    /** \return bytes granted to the sockets of the class, at most limit */
+    size_t grantClass(uint8_t priority, size_t limit);
+
+    ::async::ContextType const _context;
+    size_t const _bytesPerMs;
+    Mode _mode;
+    ::etl::vector<ZephyrSocket*, MAX_SOCKETS> _sockets;
+    uint16_t _weights[CLASS_COUNT];
+    uint32_t _granted[CLASS_COUNT];
+    uint32_t _saturated;
+    size_t _budget;
+    uint32_t _refillTimestamp;
+    size_t _nextSocket;
+    /** shared with the contexts of the sockets */
+    bool _taskPending;
+    bool _periodPending;
+    ::async::Function _scheduleTask;
+    ::async::Function _periodTask;
+    ::async::TimeoutType _periodTimeout;
+};
+
+} // namespace tcp
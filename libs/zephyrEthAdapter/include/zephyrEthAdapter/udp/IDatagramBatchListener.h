@@ -0,0 +1,39 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <etl/span.h>
+#include <ip/IPAddress.h>
+#include <zephyrEthAdapter/udp/ReceivedDatagram.h>
+
+namespace udp
+{
+class ZephyrDatagramSocket;
+
+/**
+ * Received datagram of a batch, holds a reference to its packet until the batch has been
+ * delivered.
+ */
+struct DatagramBatchEntry
+{
+    ::ip::IPAddress _sourceAddress;
+    uint16_t _sourcePort;
+    ReceivedDatagram _datagram;
+};
+
+/**
+ * Batched alternative to IDatagramListener, see ZephyrDatagramSocket::setBatchListener().
+ */
+class IDatagramBatchListener
+{
+public:
+    /**
+     * Called in the context of the batch with the datagrams in order of arrival. The
+     * datagrams are released after the call, use ReceivedDatagram::retain() to keep one.
+     */
+    virtual void datagramsReceived(
+        ZephyrDatagramSocket& socket, ::etl::span<DatagramBatchEntry const> datagrams)
+        = 0;
+};
+
+} // namespace udp
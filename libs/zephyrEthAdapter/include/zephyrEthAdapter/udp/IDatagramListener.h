@@ -0,0 +1,31 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <ip/IPAddress.h>
+#include <zephyrEthAdapter/udp/ReceivedDatagram.h>
+
+namespace udp
+{
+class ZephyrDatagramSocket;
+
+/**
+ * Zero-copy alternative to IDataListener: the payload is passed as view of the network
+ * buffers instead of being read into a buffer of the listener.
+ */
+class IDatagramListener
+{
+public:
+    /**
+     * Called from the RX thread of the network stack, or in the context of the socket if it
+     * has one, see ZephyrDatagramSocket::setContext().
+     */
+    virtual void datagramReceived(
+        ZephyrDatagramSocket& socket,
+        ::ip::IPAddress sourceAddress,
+        uint16_t sourcePort,
+        ReceivedDatagram const& datagram)
+        = 0;
+};
+
+} // namespace udp
@@ -0,0 +1,71 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <zephyr/net/net_pkt.h>
+
+#include <etl/span.h>
+#include <platform/estdint.h>
+
+namespace udp
+{
+/**
+ * Payload of a received datagram as the list of its fragments in the network buffers, so
+ * protocol parsers can work in place without a bounce buffer.
+ *
+ * The view is valid during the callback of IDatagramListener. To keep the datagram beyond
+ * the callback, take a reference with retain() and give it back with release(). Retained
+ * datagrams hold buffers of the RX pool of the stack and must be released promptly.
+ */
+class ReceivedDatagram
+{
+public:
+#if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+    /** enough for a datagram of a full Ethernet frame split into network buffers */
+    static size_t const MAX_FRAGMENTS
+        = ((1518U + CONFIG_NET_BUF_DATA_SIZE - 1U) / CONFIG_NET_BUF_DATA_SIZE) + 1U;
+#else
+    static size_t const MAX_FRAGMENTS = 4U;
+#endif
+
+    using Fragment = ::etl::span<uint8_t const>;
+
+    ReceivedDatagram();
+
+    /**
+     * Initializes the view from the current position of the packet to its end.
+     * \return false if the payload consists of more than MAX_FRAGMENTS fragments
+     */
+    bool init(struct net_pkt* pkt);
+
+    ::etl::span<Fragment const> getFragments() const
+    {
+        return ::etl::span<Fragment const>(_fragments, _fragmentCount);
+    }
+
+    size_t getLength() const { return _length; }
+
+    /**
+     * Gathers n bytes starting at offset, e.g. for a header crossing a fragment boundary.
+     * \return number of bytes copied
+     */
+    size_t copy(size_t offset, uint8_t* buffer, size_t n) const;
+
+    /**
+     * \return a view of the same datagram holding an additional reference to the packet
+     */
+    ReceivedDatagram retain() const;
+
+    /**
+     * Releases a reference taken with retain(), the view is empty afterwards.
+     */
+    void release();
+
+private:
+    struct net_pkt* _pkt;
+    Fragment _fragments[MAX_FRAGMENTS];
+    size_t _fragmentCount;
+    size_t _length;
+};
+
+} // namespace udp
@@ -0,0 +1,66 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <zephyr/net/net_pkt.h>
+
+#include <zephyrEthAdapter/udp/ReceivedDatagram.h>
+
+#include <etl/span.h>
+#include <platform/estdint.h>
+
+namespace udp
+{
+class ZephyrDatagramSocket;
+
+/**
+ * Payload area of a datagram allocated with ZephyrDatagramSocket::allocate(), as the list of
+ * its fragments in the network buffers. The caller serializes the payload directly into the
+ * fragments and hands the datagram back with ZephyrDatagramSocket::commit() or discard(),
+ * either of which must be called exactly once.
+ */
+class TransmitDatagram
+{
+public:
+    static size_t const MAX_FRAGMENTS = ReceivedDatagram::MAX_FRAGMENTS;
+
+    using Fragment = ::etl::span<uint8_t>;
+
+    TransmitDatagram();
+
+    bool isAllocated() const { return _pkt != nullptr; }
+
+    ::etl::span<Fragment const> getFragments() const
+    {
+        return ::etl::span<Fragment const>(_fragments, _fragmentCount);
+    }
+
+    /** \return allocated payload length */
+    size_t getLength() const { return _length; }
+
+    /**
+     * Scatters n bytes to the payload starting at offset, e.g. for a field crossing a fragment
+     * boundary.
+     * \return number of bytes written
+     */
+    size_t write(size_t offset, uint8_t const* buffer, size_t n);
+
+private:
+    friend class ZephyrDatagramSocket;
+
+    /**
+     * Claims length bytes of the network buffers behind the headers of the packet.
+     * \return false if the buffers are too short or too fragmented
+     */
+    bool init(struct net_pkt* pkt, size_t length);
+
+    /** \return the packet, the view is empty afterwards */
+    struct net_pkt* release();
+
+    struct net_pkt* _pkt;
+    Fragment _fragments[MAX_FRAGMENTS];
+    size_t _fragmentCount;
+    size_t _length;
+};
+
+} // namespace udp
@@ -4,18 +4,53 @@
 
 #include <async/Async.h>
 #include <udp/IDataListener.h>
+#include <zephyrEthAdapter/udp/IDatagramBatchListener.h>
+#include <zephyrEthAdapter/udp/IDatagramListener.h>
 #include <zephyrEthAdapter/udp/ZephyrDatagramSocket.h>
 
+#include <etl/optional.h>
+
 namespace udp
 {
 
 /**
  * A simple class that listens on a given IP address and port and will echo received data back to
  * the sender.
+ *
+ * Datagrams are queued by the socket and echoed in the async context passed to the
+ * constructor. They are received in place: a payload held in one network buffer is echoed
+ * directly from it, datagrams spread over several buffers are gathered into a reply built in
+ * place. In batched mode the datagrams are collected and echoed with one sendBatch() per batch.
+ * Datagrams sent to a multicast group joined with setMulticastGroup() are echoed as unicast.
  */
-class UdpEchoServer : public ::udp::IDataListener
+class UdpEchoServer
+: public ::udp::IDataListener
+, public ::udp::IDatagramListener
+, public ::udp::IDatagramBatchListener
 {
 public:
+    /** datagrams queued by the socket for the context in unbatched mode */
+    static size_t const QUEUE_CAPACITY    = 16U;
+    /** datagrams kept by the socket in batched mode */
+    static size_t const BATCH_CAPACITY    = 16U;
+    /** a batch is delivered when this many datagrams are pending... */
+    static size_t const BATCH_SIZE        = 8U;
+    /** ...or this long after the first one arrived */
+    static uint32_t const BATCH_WINDOW_MS = 1U;
+
+    struct Statistics
+    {
+        uint32_t _echoes;
+        /** echoes gathered from several network buffers into a reply built in place */
+        uint32_t _gathered;
+        uint32_t _sendErrors;
+        /** cycles spent in send() or sendBatch() of the socket, see k_cycle_get_32() */
+        uint64_t _sendCycles;
+        uint32_t _maxSendCycles;
+        /** batches received in batched mode */
+        uint32_t _batches;
+    };
+
     /**
      * Constructs an instance of UdpEchoServer at a given \p ipAddr and \p rxPort.
      * \param ipAddr    IP address of the netif to listen on. IP address 0.0.0.0 will listen on all
@@ -36,6 +71,19 @@ public:
      */
     void stop();
 
+    /**
+     * Restarts the server in batched or unbatched mode.
+     */
+    void setBatched(bool batched);
+
+    bool isBatched() const { return _batched; }
+
+    /**
+     * Joins the multicast group now if the server is running, and on every start().
+     * The server must listen on 0.0.0.0 to receive the datagrams of the group.
+     */
+    void setMulticastGroup(::ip::IPAddress const& group);
+
     void dataReceived(
         ::udp::AbstractDatagramSocket& socket,
         ::ip::IPAddress sourceAddress,
@@ -43,12 +91,44 @@ public:
         ::ip::IPAddress destinationAddress,
         uint16_t length) override;
 
+    void datagramReceived(
+        ZephyrDatagramSocket& socket,
+        ::ip::IPAddress sourceAddress,
+        uint16_t sourcePort,
+        ReceivedDatagram const& datagram) override;
+
+    void datagramsReceived(
+        ZephyrDatagramSocket& socket, ::etl::span<DatagramBatchEntry const> datagrams) override;
+
+    /** Measures the send path of the replies, e.g. while running echo_test_udp.py. */
+    Statistics const& getStatistics() const { return _statistics; }
+
+    void resetStatistics();
+
+    /** Measures the hand-over of datagrams from the network RX thread to the context. */
+    ::zethutils::DeliveryStatistics const& getDeliveryStatistics() const
+    {
+        return _socket.getDeliveryStatistics();
+    }
+
+    /** \return datagrams dropped in batched mode because the batch storage was full */
+    uint32_t getBatchDropCount() const { return _socket.getBatchDropCount(); }
+
 private:
+    void echo(
+        uint8_t const* data, uint16_t length, ::ip::IPAddress const& address, uint16_t port);
+    void recordSend(uint32_t cycles, size_t echoes, size_t errors);
+
     ip::IPAddress const _ipAddr;
     uint16_t const _rxPort;
     ::udp::ZephyrDatagramSocket _socket;
     uint8_t _receiveData[1518U];
     ::async::ContextType _context;
+    Statistics _statistics;
+    bool _batched;
+    ::etl::optional<::ip::IPAddress> _multicastGroup;
+    ZephyrDatagramSocket::QueuedDatagram _queue[QUEUE_CAPACITY];
+    DatagramBatchEntry _batch[BATCH_CAPACITY];
 };
 
 } // namespace udp
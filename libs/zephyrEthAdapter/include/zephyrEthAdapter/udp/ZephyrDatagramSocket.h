@@ -4,10 +4,18 @@
 
 #include <zephyr/net/net_context.h>
 
+#include <async/Async.h>
+#include <async/util/Call.h>
 #include <ip/IPAddress.h>
 #include <udp/socket/AbstractDatagramSocket.h>
+#include <zephyrEthAdapter/udp/IDatagramBatchListener.h>
+#include <zephyrEthAdapter/udp/IDatagramListener.h>
+#include <zephyrEthAdapter/udp/ReceivedDatagram.h>
+#include <zephyrEthAdapter/udp/TransmitDatagram.h>
+#include <zephyrEthAdapter/utils/DeliveryStatistics.h>
 
 #include <etl/optional.h>
+#include <etl/vector.h>
 #include <platform/estdint.h>
 
 namespace udp
@@ -21,6 +29,21 @@ namespace udp
 class ZephyrDatagramSocket : public AbstractDatagramSocket
 {
 public:
+    /** Received datagram waiting for the context of the socket. */
+    struct QueuedDatagram
+    {
+        struct net_pkt* _pkt;
+        ip::IPAddress _sourceAddress;
+        uint16_t _sourcePort;
+        /** k_cycle_get_32() when the datagram was queued */
+        uint32_t _timestamp;
+    };
+
+    /** maximum number of multicast groups a socket can be member of */
+    static size_t const MAX_MULTICAST_GROUPS = 4U;
+    /** maximum number of groups the sockets are member of together, counted per interface */
+    static size_t const MAX_MEMBERSHIPS = 8U;
+
     ZephyrDatagramSocket();
 
     virtual ~ZephyrDatagramSocket() = default;
@@ -31,10 +54,40 @@ public:
     ErrorCode bind(ip::IPAddress const* pIpAddress, uint16_t port) override;
 
     /**
+     * Joins the multicast group through IGMP (IPv4) or MLD (IPv6) on the multicast interface,
+     * see setMulticastInterface(). To receive the datagrams of the group, the socket must be
+     * bound to the unspecified address. The groups are left on close(). The membership of an
+     * interface is counted over all sockets, so sockets can join the same group.
      * \see AbstractDatagramSocket::join();
      */
     ErrorCode join(ip::IPAddress const& groupAddr) override;
 
+    /**
+     * Leaves a multicast group joined with join() on the current multicast interface. The
+     * interface leaves the group when the last socket which joined it leaves.
+     */
+    ErrorCode leave(ip::IPAddress const& groupAddr);
+
+    /**
+     * Sets the TTL (IPv4) or hop limit (IPv6) of multicast datagrams, 1 by default.
+     * The socket must be bound.
+     */
+    ErrorCode setMulticastTtl(uint8_t ttl);
+
+    /**
+     * Selects the interface by its index for joining groups and sending multicast datagrams,
+     * 0 selects the interface the socket is bound to. Applies to groups joined afterwards.
+     * The socket must be bound.
+     */
+    ErrorCode setMulticastInterface(int ifIndex);
+
+    /**
+     * Sets the traffic class of the datagrams sent, 0 (NET_PRIORITY_BE) by default, up to
+     * NET_MAX_PRIORITIES - 1. The stack selects the TX queue by it and maps it to the PCP of a
+     * VLAN tag. Needs CONFIG_NET_CONTEXT_PRIORITY, the socket must be bound.
+     */
+    ErrorCode setPriority(uint8_t priority);
+
     /**
      * \see AbstractDatagramSocket::isBound();
      */
@@ -101,6 +154,80 @@ public:
      */
     uint16_t getLocalPort() const override;
 
+    /**
+     * Excludes the traffic of this socket from the bus capture, e.g. for the socket streaming
+     * the capture itself.
+     */
+    void setCaptured(bool captured) { _captured = captured; }
+
+    /**
+     * Delivers received datagrams in place to the given listener instead of the data
+     * listener, nullptr switches back to the data listener.
+     */
+    void setDatagramListener(IDatagramListener* listener) { _datagramListener = listener; }
+
+    /**
+     * \return datagrams not delivered to the datagram listener because they consist of more
+     * than ReceivedDatagram::MAX_FRAGMENTS network buffers
+     */
+    uint32_t getFragmentedDropCount() const { return _fragmentedDrops; }
+
+    /**
+     * Sends the packets one after the other with a single check of the socket state, like
+     * sendmmsg() it stops at the first packet which can't be sent.
+     * \return number of packets sent
+     */
+    size_t sendBatch(::etl::span<DatagramPacket const> packets);
+
+    /**
+     * Switches to batched reception, which takes precedence over the other listeners: received
+     * datagrams are kept in storage and delivered to the listener in one call in the given
+     * context as soon as batchSize of them are pending, or windowMs after the first one has
+     * arrived. Datagrams arriving while storage is full are dropped, so storage should leave
+     * room for the datagrams arriving until the context runs. Must be called before bind().
+     */
+    void setBatchListener(
+        IDatagramBatchListener* listener,
+        ::async::ContextType context,
+        ::etl::span<DatagramBatchEntry> storage,
+        size_t batchSize,
+        uint32_t windowMs);
+
+    /** \return datagrams dropped because the batch storage was full */
+    uint32_t getBatchDropCount() const { return _batchDrops; }
+
+    /**
+     * Delivers received datagrams to the data or datagram listener in the given context
+     * instead of the RX thread of the network stack. The RX thread only queues them, datagrams
+     * arriving while the queue is full are dropped. Must be called before bind().
+     */
+    void setContext(::async::ContextType context, ::etl::span<QueuedDatagram> queue);
+
+    ::zethutils::DeliveryStatistics const& getDeliveryStatistics() const
+    {
+        return _deliveryStatistics;
+    }
+
+    void resetDeliveryStatistics();
+
+    /**
+     * Allocates a datagram with room for length bytes of payload to the given destination.
+     * The payload is serialized directly into the network buffers of the datagram and sent
+     * with commit(), which saves the copy send() makes from the user buffer.
+     */
+    ErrorCode allocate(
+        ip::IPAddress const& address, uint16_t port, size_t length, TransmitDatagram& datagram);
+
+    /**
+     * Sends a datagram from allocate() with the first length bytes of its payload.
+     */
+    ErrorCode commit(TransmitDatagram& datagram, size_t length);
+
+    /**
+     * Gives back a datagram from allocate() without sending it.
+     */
+    void discard(TransmitDatagram& datagram);
+
     void receivedCallback(struct net_context *ctx,
                            struct net_pkt *pkt,
                            union net_ip_header *ip_hdr,
@@ -115,13 +242,93 @@ private:
                            int status,
                            void *user_data);
 
+    /** Converts the destination to _destinationAddr unless it is the cached one. */
+    void setDestination(ip::IPAddress const& address, uint16_t port);
+
+    ErrorCode sendTo(DatagramPacket const& packet);
+
+    /** Passes the datagram to the data or datagram listener. */
+    void deliver(ip::IPAddress const& sourceAddress, uint16_t sourcePort, struct net_pkt* pkt);
+    /** Called from the RX thread, keeps the packet in the queue. */
+    void enqueue(ip::IPAddress const& sourceAddress, uint16_t sourcePort, struct net_pkt* pkt);
+    void queueTask();
+    void releaseQueue();
+
+    struct MulticastGroup
+    {
+        ip::IPAddress _address;
+        struct net_if* _iface;
+    };
+
+    struct net_if* getMulticastInterface() const;
+    /** \return result of the IGMP/MLD join or leave */
+    static int updateMembership(ip::IPAddress const& group, struct net_if* iface, bool join);
+    /**
+     * Counts a socket as member of the group on the interface, the first one joins it.
+     * \return 0 or the error of the join
+     */
+    static int acquireMembership(ip::IPAddress const& group, struct net_if* iface);
+    /** Releases acquireMembership(), the last socket leaves the group. */
+    static void releaseMembership(ip::IPAddress const& group, struct net_if* iface);
+    void leaveAll();
+
+    /** Called from the RX thread, keeps the packet in the batch storage. */
+    void addToBatch(ip::IPAddress const& sourceAddress, uint16_t sourcePort, struct net_pkt* pkt);
+    /** Delivers a full batch or starts the window, in the batch context. */
+    void batchTask();
+    void batchWindowTask();
+    void deliverBatch();
+    void scheduleBatchWindow();
+    void releaseBatch();
+
     int _socket;
     struct net_context* _netContext;
     struct net_pkt* _currentPkt;
     bool _isBound;
     bool _isConnected;
-    etl::optional<sockaddr> _localAddr;
-    etl::optional<sockaddr> _peerAddr;
+    bool _captured;
+    IDatagramListener* _datagramListener;
+    ReceivedDatagram _datagram;
+    uint32_t _fragmentedDrops;
+    IDatagramBatchListener* _batchListener;
+    ::async::ContextType _batchContext;
+    ::etl::span<DatagramBatchEntry> _batch;
+    size_t _batchSize;
+    uint32_t _batchWindowMs;
+    /** pending datagrams, shared with the RX thread */
+    size_t _batchCount;
+    /** datagrams at the front of the storage handed to the listener, released by the delivery */
+    size_t _batchDelivering;
+    bool _batchTaskPending;
+    bool _batchWindowPending;
+    uint32_t _batchDrops;
+    ::async::Function _batchTask;
+    ::async::Function _batchWindowTask;
+    ::async::TimeoutType _batchTimeout;
+    ::async::ContextType _context;
+    ::etl::span<QueuedDatagram> _queue;
+    /** queue shared with the RX thread */
+    size_t _queueHead;
+    size_t _queueCount;
+    bool _queueTaskPending;
+    ::async::Function _queueTask;
+    ::zethutils::DeliveryStatistics _deliveryStatistics;
+    ::etl::vector<MulticastGroup, MAX_MULTICAST_GROUPS> _multicastGroups;
+    struct net_if* _multicastIface;
+    etl::optional<sockaddr_storage> _localAddr;
+    etl::optional<sockaddr_storage> _peerAddr;
+    socklen_t _peerAddrLen;
+    /** _localAddr as passed to bind(), reported with every received datagram */
+    ip::IPAddress _localIpAddress;
+    /**
+     * Destination of the last send(DatagramPacket), replies mostly go to the same endpoint
+     * so its sockaddr is only converted when the endpoint changes. Not valid if the length
+     * is 0.
+     */
+    ip::IPAddress _destinationIpAddress;
+    uint16_t _destinationPort;
+    socklen_t _destinationAddrLen;
+    sockaddr_storage _destinationAddr;
     ip::IPAddress::Family _addressFamily;
 };
 
@@ -0,0 +1,31 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/net_pkt.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Allocates a UDP packet from the bound context to dst with IP and UDP header written and the
+ * cursor at the payload, the network buffers have room for length bytes of payload.
+ * Multicast packets are sent on mcast_iface if it is not NULL, with the multicast TTL or hop
+ * limit of the context. The packet gets the priority of the context.
+ * \return NULL if no packet is available or the destination is not reachable
+ */
+struct net_pkt* zeth_udp_alloc(struct net_context *context,
+    const struct sockaddr *dst, struct net_if *mcast_iface,
+    size_t length, k_timeout_t timeout);
+
+/**
+ * Fills in the lengths and checksums of the IP and UDP header, the packet is ready for
+ * net_send_data() afterwards.
+ */
+int zeth_udp_finalize(struct net_pkt *pkt);
+
+#ifdef __cplusplus
+}
+#endif
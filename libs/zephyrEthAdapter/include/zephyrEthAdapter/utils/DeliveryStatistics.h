@@ -0,0 +1,50 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <platform/estdint.h>
+
+namespace zethutils
+{
+/**
+ * Measures the hand-over of socket events from the RX thread of the network stack to the
+ * async context of a socket.
+ */
+struct DeliveryStatistics
+{
+    /** events delivered in the context */
+    uint32_t _delivered;
+    /** runs in the context, coalesced events are delivered in one run */
+    uint32_t _deliveries;
+    /** events dropped because the queue was full */
+    uint32_t _drops;
+    /** maximum number of events waiting for the context */
+    uint32_t _maxDepth;
+    /**
+     * cycles from the RX thread to the context of the oldest event of each delivery, see
+     * k_cycle_get_32()
+     */
+    uint64_t _delayCycles;
+    uint32_t _maxDelayCycles;
+
+    void queued(uint32_t const depth)
+    {
+        if (depth > _maxDepth)
+        {
+            _maxDepth = depth;
+        }
+    }
+
+    void delivered(uint32_t const events, uint32_t const delayCycles)
+    {
+        _delivered += events;
+        ++_deliveries;
+        _delayCycles += delayCycles;
+        if (delayCycles > _maxDelayCycles)
+        {
+            _maxDelayCycles = delayCycles;
+        }
+    }
+};
+
+} // namespace zethutils
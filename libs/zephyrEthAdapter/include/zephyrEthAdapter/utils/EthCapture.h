@@ -0,0 +1,159 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <capture/Capture.h>
+
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+namespace zethutils
+{
+/**
+ * Capture hooks of the sockets. Packets are recorded with the index of the network interface
+ * as bus ID. UDP packets are received with their IP and UDP header, for TCP only the payload
+ * is visible and the headers are synthesized.
+ */
+
+inline uint8_t captureBusId(struct net_context const* const context)
+{
+    struct net_if* const iface = net_context_get_iface(const_cast<struct net_context*>(context));
+    return (iface != nullptr) ? static_cast<uint8_t>(net_if_get_by_iface(iface)) : 0U;
+}
+
+inline uint8_t const* captureAddr(sockaddr const& addr)
+{
+    return (addr.sa_family == AF_INET6)
+               ? reinterpret_cast<sockaddr_in6 const&>(addr).sin6_addr.s6_addr
+               : reinterpret_cast<sockaddr_in const&>(addr).sin_addr.s4_addr;
+}
+
+inline uint16_t capturePort(sockaddr const& addr)
+{
+    return ntohs(
+        (addr.sa_family == AF_INET6) ? reinterpret_cast<sockaddr_in6 const&>(addr).sin6_port
+                                     : reinterpret_cast<sockaddr_in const&>(addr).sin_port);
+}
+
+/**
+ * \return local address of the context, all zeros if it is not bound to an address
+ */
+inline uint8_t const* captureLocalAddr(struct net_context const* const context)
+{
+    static uint8_t const anyAddr[16] = {};
+    if (context->local.family == AF_INET6)
+    {
+        struct in6_addr const* const addr = net_sin6_ptr(&context->local)->sin6_addr;
+        return (addr != nullptr) ? addr->s6_addr : anyAddr;
+    }
+    struct in_addr const* const addr = net_sin_ptr(&context->local)->sin_addr;
+    return (addr != nullptr) ? addr->s4_addr : anyAddr;
+}
+
+inline uint16_t captureLocalPort(struct net_context const* const context)
+{
+    return ntohs(
+        (context->local.family == AF_INET6) ? net_sin6_ptr(&context->local)->sin6_port
+                                            : net_sin_ptr(&context->local)->sin_port);
+}
+
+/**
+ * Records a packet starting with its IP header.
+ */
+inline void capturePacket(::capture::RecordType const type, struct net_pkt* const pkt)
+{
+    ::capture::CaptureRing& ring     = ::capture::getCaptureRing();
+    ::capture::CaptureRecord* record = ring.reserve();
+    if (record == nullptr)
+    {
+        return;
+    }
+    size_t const length     = net_pkt_get_len(pkt);
+    record->_type           = type;
+    record->_busId          = static_cast<uint8_t>(net_if_get_by_iface(net_pkt_iface(pkt)));
+    record->_id             = 0U;
+    record->_flags          = 0U;
+    record->_length         = static_cast<uint16_t>(length);
+    record->_capturedLength = static_cast<uint16_t>(
+        net_buf_linearize(record->_data, CAPTURE_SNAP_LENGTH, pkt->buffer, 0U, length));
+    ring.commit(*record);
+}
+
+inline void captureRxPacket(struct net_pkt* const pkt)
+{
+    capturePacket(::capture::RecordType::ETH_RX, pkt);
+}
+
+/**
+ * Records a packet built in place, its IP and UDP header are complete after finalization.
+ */
+inline void captureTxPacket(struct net_pkt* const pkt)
+{
+    capturePacket(::capture::RecordType::ETH_TX, pkt);
+}
+
+/**
+ * Records the payload of a received TCP packet with synthesized headers.
+ */
+inline void captureTcpRxPayload(struct net_context const* const context, struct net_pkt* const pkt)
+{
+    ::capture::CaptureRing& ring     = ::capture::getCaptureRing();
+    ::capture::CaptureRecord* record = ring.reserve();
+    if (record == nullptr)
+    {
+        return;
+    }
+    sockaddr const& remote = context->remote;
+    ::capture::IpInfo const info
+        = {captureAddr(remote),
+           captureLocalAddr(context),
+           capturePort(remote),
+           captureLocalPort(context),
+           0U,
+           0U,
+           IPPROTO_TCP,
+           remote.sa_family == AF_INET6};
+    size_t const length       = net_pkt_remaining_data(pkt);
+    size_t const headerLength = ::capture::writeIpHeaders(record->_data, info, length);
+    // the cursor of the packet is not moved, the socket reads the payload later
+    size_t const offset       = net_pkt_get_len(pkt) - length;
+    size_t const copied       = net_buf_linearize(
+        &record->_data[headerLength], CAPTURE_SNAP_LENGTH - headerLength, pkt->buffer, offset, length);
+    record->_type           = ::capture::RecordType::ETH_RX;
+    record->_busId          = captureBusId(context);
+    record->_id             = 0U;
+    record->_flags          = 0U;
+    record->_length         = static_cast<uint16_t>(headerLength + length);
+    record->_capturedLength = static_cast<uint16_t>(headerLength + copied);
+    ring.commit(*record);
+}
+
+/**
+ * Records transmitted payload with synthesized IP and UDP/TCP header.
+ * \param remote destination of the payload
+ */
+inline void captureTxPayload(
+    struct net_context const* const context,
+    sockaddr const& remote,
+    uint8_t const protocol,
+    ::etl::span<uint8_t const> const payload)
+{
+    if (!::capture::getCaptureRing().isEnabled())
+    {
+        return;
+    }
+    ::capture::IpInfo const info
+        = {captureLocalAddr(context),
+           captureAddr(remote),
+           captureLocalPort(context),
+           capturePort(remote),
+           0U,
+           0U,
+           protocol,
+           remote.sa_family == AF_INET6};
+    ::capture::captureIpPayload(
+        ::capture::RecordType::ETH_TX, captureBusId(context), info, payload);
+}
+
+} // namespace zethutils
@@ -10,6 +10,8 @@
 #include <udp/UdpLogger.h>
 #include <etl/memory.h>
 
+#include <cstring>
+
 namespace zethutils
 {
 namespace logger = ::util::logger;
@@ -43,31 +45,42 @@ static inline bool setblocking(int fd, bool val)
     return true;
 }
 
-inline sockaddr toSockAddr(ip::IPAddress const* ip, uint16_t port)
+/**
+ * Converts the binary address into a sockaddr_in or sockaddr_in6 without formatting and
+ * parsing its text representation.
+ * \return length of the resulting address, 0 for nullptr (AF_UNSPEC)
+ */
+inline socklen_t toSockAddr(ip::IPAddress const* ip, uint16_t port, sockaddr_storage& addr)
 {
-    sockaddr addr{};
+    memset(&addr, 0, sizeof(addr));
     if (!ip)
     {
-        addr.sa_family = AF_UNSPEC;
-        return addr;
+        addr.ss_family = AF_UNSPEC;
+        return 0U;
     }
     if (addressFamilyOf(*ip) == ip::IPAddress::IPV4)
     {
-        sockaddr_in* ipv4_addr = reinterpret_cast<sockaddr_in*>(&addr);
-        ipv4_addr->sin_family = AF_INET;
-        ipv4_addr->sin_port   = htons(port);
-        char strBuffer[INET_ADDRSTRLEN];
-        zsock_inet_pton(AF_INET, ip::to_str(*ip, strBuffer).data(), &ipv4_addr->sin_addr);
-    }
-    else
-    {
-        sockaddr_in6* ipv6_addr = reinterpret_cast<sockaddr_in6*>(&addr);
-        ipv6_addr->sin6_family = AF_INET6;
-        ipv6_addr->sin6_port   = htons(port);
-        char strBuffer[INET6_ADDRSTRLEN];
-        zsock_inet_pton(AF_INET6, ip::to_str(*ip, strBuffer).data(), &ipv6_addr->sin6_addr);
+        sockaddr_in& ipv4_addr    = reinterpret_cast<sockaddr_in&>(addr);
+        ipv4_addr.sin_family      = AF_INET;
+        ipv4_addr.sin_port        = htons(port);
+        ipv4_addr.sin_addr.s_addr = htonl(ip::ip4_to_u32(*ip));
+        return sizeof(sockaddr_in);
     }
-    return addr;
+    sockaddr_in6& ipv6_addr = reinterpret_cast<sockaddr_in6&>(addr);
+    ipv6_addr.sin6_family   = AF_INET6;
+    ipv6_addr.sin6_port     = htons(port);
+    memcpy(ipv6_addr.sin6_addr.s6_addr, ip::packed(*ip).data(), sizeof(ipv6_addr.sin6_addr));
+    return sizeof(sockaddr_in6);
+}
+
+inline sockaddr* toSockAddrPtr(sockaddr_storage& addr)
+{
+    return reinterpret_cast<sockaddr*>(&addr);
+}
+
+inline sockaddr const& toSockAddrRef(sockaddr_storage const& addr)
+{
+    return reinterpret_cast<sockaddr const&>(addr);
 }
 
 inline ip::IPAddress fromSockAddr(sockaddr const& addr)
@@ -94,6 +107,11 @@ inline ip::IPAddress fromSockAddr(sockaddr const& addr)
     }
 }
 
+inline ip::IPAddress fromSockAddr(sockaddr_storage const& addr)
+{
+    return fromSockAddr(toSockAddrRef(addr));
+}
+
 inline ip::IPAddress fromSockAddr(sockaddr_ptr const& addr)
 {
     if (addr.family == AF_INET)
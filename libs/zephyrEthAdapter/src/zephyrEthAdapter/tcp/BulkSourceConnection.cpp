@@ -0,0 +1,63 @@
+// Copyright 2025 Accenture.
+
+#include "zephyrEthAdapter/tcp/BulkSourceConnection.h"
+
+#include <tcp/TcpLogger.h>
+
+namespace tcp
+{
+using ::util::logger::Logger;
+using ::util::logger::TCP;
+
+size_t const BulkSourceConnection::CHUNK_LENGTH;
+size_t const BulkSourceConnection::SEND_BUFFER_SIZE;
+
+BulkSourceConnection::BulkSourceConnection()
+: _socket(nullptr), _sent(0U), _chunk(), _sendBuffer()
+{
+    for (size_t i = 0U; i < CHUNK_LENGTH; ++i)
+    {
+        _chunk[i] = static_cast<uint8_t>(i);
+    }
+}
+
+void BulkSourceConnection::connectionAccepted(ZephyrSocket& socket)
+{
+    _socket = &socket;
+    _sent   = 0U;
+    _socket->setSendBuffer(_sendBuffer);
+    _socket->setDataListener(this);
+    _socket->setSendNotificationListener(this);
+    fill();
+}
+
+void BulkSourceConnection::dataReceived(uint16_t /*length*/)
+{
+    if (_socket != nullptr)
+    {
+        _socket->discardData();
+    }
+}
+
+void BulkSourceConnection::dataSent(uint16_t /*length*/, SendResult /*result*/) { fill(); }
+
+void BulkSourceConnection::connectionClosed(ErrorCode /*status*/)
+{
+    Logger::debug(
+        TCP, "BulkSourceConnection: closed after %u bytes", static_cast<unsigned int>(_sent));
+}
+
+void BulkSourceConnection::fill()
+{
+    ::etl::span<uint8_t const> const chunk(_chunk, CHUNK_LENGTH);
+    while ((_socket != nullptr) && !_socket->isClosed() && (_socket->available() >= CHUNK_LENGTH))
+    {
+        if (_socket->send(chunk) != AbstractSocket::ErrorCode::SOCKET_ERR_OK)
+        {
+            break;
+        }
+        _sent += CHUNK_LENGTH;
+    }
+}
+
+} // namespace tcp
@@ -0,0 +1,94 @@
+// Copyright 2025 Accenture.
+
+#include "zephyrEthAdapter/tcp/FramedEchoConnection.h"
+
+#include <tcp/TcpLogger.h>
+
+namespace tcp
+{
+using ::util::logger::Logger;
+using ::util::logger::TCP;
+
+size_t const FramedEchoConnection::HEADER_LENGTH;
+size_t const FramedEchoConnection::MAX_PAYLOAD_LENGTH;
+size_t const FramedEchoConnection::SEND_BUFFER_SIZE;
+
+FramedEchoConnection::FramedEchoConnection()
+: _socket(nullptr), _frames(0U), _frame(), _sendBuffer()
+{}
+
+void FramedEchoConnection::connectionAccepted(ZephyrSocket& socket)
+{
+    _socket = &socket;
+    _frames = 0U;
+    _socket->setSendBuffer(_sendBuffer);
+    _socket->setDataListener(this);
+    _socket->setSendNotificationListener(this);
+    (void)_socket->setReceiveThreshold(HEADER_LENGTH);
+}
+
+void FramedEchoConnection::dataReceived(uint16_t /*length*/)
+{
+    while (echoFrame()) {}
+}
+
+void FramedEchoConnection::dataSent(uint16_t /*length*/, SendResult /*result*/)
+{
+    // frames held back for lack of send buffer
+    while (echoFrame()) {}
+}
+
+void FramedEchoConnection::connectionClosed(ErrorCode /*status*/)
+{
+    Logger::debug(
+        TCP, "FramedEchoConnection: closed after %u frames", static_cast<unsigned int>(_frames));
+}
+
+bool FramedEchoConnection::echoFrame()
+{
+    if (_socket == nullptr)
+    {
+        return false;
+    }
+    ::etl::span<uint8_t const> const header = _socket->peek(HEADER_LENGTH);
+    if (header.empty())
+    {
+        // another frame may have arrived in the meantime
+        return _socket->setReceiveThreshold(HEADER_LENGTH);
+    }
+    size_t const length
+        = HEADER_LENGTH + ((static_cast<size_t>(header[0U]) << 8U) | header[1U]);
+    if (length > sizeof(_frame))
+    {
+        Logger::error(
+            TCP, "FramedEchoConnection: frame of %d bytes too long", static_cast<int>(length));
+        _socket->discardData();
+        (void)_socket->close();
+        return false;
+    }
+    if (_socket->getReceivedLength() < length)
+    {
+        return _socket->setReceiveThreshold(length);
+    }
+    if (_socket->available() < length)
+    {
+        // continued by dataSent()
+        return false;
+    }
+    ::etl::span<uint8_t const> const frame = _socket->peek(length);
+    if (frame.empty())
+    {
+        // spread over several network buffers
+        (void)_socket->read(_frame, length);
+        (void)_socket->send(::etl::span<uint8_t const>(_frame, length));
+    }
+    else
+    {
+        (void)_socket->send(frame);
+        (void)_socket->consume(length);
+    }
+    ++_frames;
+    return true;
+}
+
+} // namespace tcp
@@ -0,0 +1,77 @@
+// Copyright 2025 Accenture.
+
+#include "zephyrEthAdapter/tcp/ZephyrConnectionPool.h"
+
+#include <tcp/TcpLogger.h>
+
+namespace tcp
+{
+using ::util::logger::Logger;
+using ::util::logger::TCP;
+
+ZephyrConnectionPool::ZephyrConnectionPool(::etl::span<Slot const> const slots)
+: _slots(slots), _accepted(0U), _rejected(0U)
+{}
+
+AbstractSocket*
+ZephyrConnectionPool::getSocket(ip::IPAddress const& /*ipAddr*/, uint16_t /*port*/)
+{
+    for (Slot const& slot : _slots)
+    {
+        // the close notification has to run in the context of the slot before it's reused
+        if (slot._socket->isClosed() && !slot._socket->isNotificationPending())
+        {
+            return slot._socket;
+        }
+    }
+    ++_rejected;
+    Logger::warn(
+        TCP, "ZephyrConnectionPool: all %d connections in use", static_cast<int>(_slots.size()));
+    return nullptr;
+}
+
+void ZephyrConnectionPool::connectionAccepted(AbstractSocket& socket)
+{
+    for (Slot const& slot : _slots)
+    {
+        if (slot._socket == &socket)
+        {
+            ++_accepted;
+            slot._handler->connectionAccepted(*slot._socket);
+            return;
+        }
+    }
+}
+
+void ZephyrConnectionPool::setPriority(uint8_t const priority)
+{
+    for (Slot const& slot : _slots)
+    {
+        slot._socket->setPriority(priority);
+    }
+}
+
+bool ZephyrConnectionPool::setTxScheduler(ZephyrTxScheduler& scheduler)
+{
+    bool added = true;
+    for (Slot const& slot : _slots)
+    {
+        added = scheduler.add(*slot._socket) && added;
+    }
+    return added;
+}
+
+size_t ZephyrConnectionPool::getActiveCount() const
+{
+    size_t count = 0U;
+    for (Slot const& slot : _slots)
+    {
+        if (!slot._socket->isClosed())
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace tcp
@@ -18,12 +18,14 @@ namespace logger = ::util::logger;
 ZephyrServerSocket::ZephyrServerSocket() 
 : AbstractServerSocket() 
 , _netContext(nullptr)
+, _backlog(1)
 {}
 
 ZephyrServerSocket::ZephyrServerSocket(
     uint16_t const port, ISocketProvidingConnectionListener& providingListener)
 : AbstractServerSocket(port, providingListener)
 , _netContext(nullptr)
+, _backlog(1)
 {}
 
 bool ZephyrServerSocket::bind(IPAddress const& localIpAddress, uint16_t port)
@@ -63,9 +65,10 @@ bool ZephyrServerSocket::createAndBindSocket(IPAddress const& localIpAddress, ui
         logger::Logger::error(logger::TCP, "ZephyrServerSocket::bind(): creation failed");
         return false;
     }
-    sockaddr addr = zethutils::toSockAddr(&localIpAddress, port);
+    sockaddr_storage addr;
+    socklen_t const addrLen = zethutils::toSockAddr(&localIpAddress, port, addr);
 
-    res = net_context_bind(_netContext, &addr, sizeof(addr));
+    res = net_context_bind(_netContext, zethutils::toSockAddrPtr(addr), addrLen);
     if (res < 0)
     {
         logger::Logger::error(logger::TCP, "ZephyrServerSocket::bind(): bind failed");
@@ -91,7 +94,7 @@ bool ZephyrServerSocket::accept()
             return false;
         }
     }
-    int res = net_context_listen(_netContext, 1);
+    int res = net_context_listen(_netContext, _backlog);
     if (res < 0) {
         return false;
     }
@@ -144,6 +147,8 @@ void ZephyrServerSocket::acceptedCallback(struct net_context *new_ctx,
                     logger::TCP,
                     "ZephyrServerSocket::acceptCallback(): SocketProvidingConnectionListener provided no "
                     "socket");
+                // rejects the connection, the context would be lost otherwise
+                (void)net_context_put(new_ctx);
                 return;
             }
             logger::Logger::debug(
@@ -2,13 +2,20 @@
 
 #include "zephyrEthAdapter/tcp/ZephyrSocket.h"
 #include <zephyr/net/net_pkt.h>
+#include "zephyrEthAdapter/tcp/ZephyrTxScheduler.h"
 #include "zephyrEthAdapter/utils/EthHelper.h"
+#ifdef PLATFORM_SUPPORT_CAPTURE
+#include "zephyrEthAdapter/utils/EthCapture.h"
+#endif
 
+#include <etl/algorithm.h>
 #include <ip/to_str.h>
 #include <tcp/IDataListener.h>
 #include <tcp/IDataSendNotificationListener.h>
 #include <tcp/TcpLogger.h>
 
+#include <cstring>
+
 namespace tcp
 {
 namespace logger = ::util::logger;
@@ -17,31 +24,114 @@ using ::ip::IPAddress;
 using ::ip::IPEndpoint;
 using ::ip::make_ip4;
 
+size_t const ZephyrSocket::MAX_PEEK_LENGTH;
+size_t const ZephyrSocket::RECEIVE_WINDOW_UPDATE_LENGTH;
+uint32_t const ZephyrSocket::SEND_RETRY_MS;
+
+namespace
+{
+/** \return the bytes from the read position of the packet up to the end of its buffer */
+::etl::span<uint8_t const> contiguousData(struct net_pkt* const pkt)
+{
+    struct net_buf* buf     = pkt->cursor.buf;
+    uint8_t const* position = pkt->cursor.pos;
+    // the cursor may still point to the end of a buffer read completely
+    while ((buf != nullptr) && (position >= (buf->data + buf->len)))
+    {
+        buf      = buf->frags;
+        position = (buf != nullptr) ? buf->data : nullptr;
+    }
+    if (buf == nullptr)
+    {
+        return ::etl::span<uint8_t const>();
+    }
+    size_t length          = static_cast<size_t>((buf->data + buf->len) - position);
+    size_t const remaining = net_pkt_remaining_data(pkt);
+    if (length > remaining)
+    {
+        length = remaining;
+    }
+    return ::etl::span<uint8_t const>(position, length);
+}
+
+/** \return the packet queued after pkt, k_fifo links them through their first word */
+struct net_pkt* nextPacket(struct net_pkt* const pkt)
+{
+    ::async::LockType const lock;
+    return reinterpret_cast<struct net_pkt*>(
+        sys_sflist_peek_next(reinterpret_cast<sys_sfnode_t*>(pkt)));
+}
+} // namespace
+
 ZephyrSocket::ZephyrSocket()
 : _delegate()
 , _connecting(false)
 , _isAborted(false)
 , _netContext(nullptr)
-{}
+, _context(::async::CONTEXT_INVALID)
+, _pendingLength(0U)
+, _pendingPackets(0U)
+, _pendingTimestamp(0U)
+, _pendingClose(false)
+, _notificationTaskPending(false)
+, _notificationTask(
+      ::async::Function::CallType::create<ZephyrSocket, &ZephyrSocket::notificationTask>(*this))
+, _deliveryStatistics()
+, _receivedLength(0U)
+, _unnotifiedLength(0U)
+, _receiveThreshold(1U)
+, _windowUpdateLength(0U)
+, _peekBuffer()
+, _sendBuffer()
+, _sendHead(0U)
+, _sendCount(0U)
+, _sendCredit(0U)
+, _pushTaskPending(false)
+, _pushRetryPending(false)
+, _pushTask(::async::Function::CallType::create<ZephyrSocket, &ZephyrSocket::pushTask>(*this))
+, _pushRetryTask(
+      ::async::Function::CallType::create<ZephyrSocket, &ZephyrSocket::pushRetryTask>(*this))
+, _pushRetryTimeout()
+, _scheduler(nullptr)
+, _priority(0U)
+{
+    k_fifo_init(&_receive_q);
+}
 
 bool ZephyrSocket::open(struct net_context* context)
 {
     //TASK_ASSERT_HOOK();
 
-    if (isClosed())
-    {
-        _netContext = context;
-    }
-    else
+    if (!isClosed())
     {
         logger::Logger::error(logger::TCP, "ZephyrSocket::open() called in illegal state != CLOSED");
         return false;
     }
-    k_fifo_init(&_receive_q);
+    // packets of the previous connection, the window of its context doesn't matter anymore
+    discardData();
+    _netContext = context;
+    {
+        // a notification of the previous connection still queued delivers nothing
+        ::async::LockType const lock;
+        _pendingLength  = 0U;
+        _pendingPackets = 0U;
+        _pendingClose   = false;
+    }
+    _receivedLength     = 0U;
+    _unnotifiedLength   = 0U;
+    _receiveThreshold   = 1U;
+    _windowUpdateLength = 0U;
+    _sendHead           = 0U;
+    {
+        ::async::LockType const lock;
+        _sendCount  = 0U;
+        _sendCredit = 0U;
+    }
     int res = net_context_recv(_netContext, ZephyrSocket::zeth_received_cb, K_NO_WAIT, this);
     if (res < 0) {
         return false;
     }
+    applyPriority();
     logger::Logger::info(logger::TCP, "ZephyrSocket::open() success");
     return true;
 }
@@ -94,9 +184,10 @@ ZephyrSocket::connect(ip::IPAddress const& ipAddr, uint16_t port, ConnectedDeleg
         return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
     }
 
-    sockaddr addr = zethutils::toSockAddr(&ipAddr, port);
-    ret = net_context_connect(_netContext, &addr, sizeof(addr), ZephyrSocket::zeth_connected_cb,
-        timeout, this);
+    sockaddr_storage addr;
+    socklen_t const addrLen = zethutils::toSockAddr(&ipAddr, port, addr);
+    ret = net_context_connect(_netContext, zethutils::toSockAddrPtr(addr), addrLen,
+        ZephyrSocket::zeth_connected_cb, timeout, this);
 
     if (ret < 0)
     {
@@ -145,18 +236,110 @@ void ZephyrSocket::receivedCallback(struct net_context * /*ctx*/,
 
     if (status != 0)
     {
-        (void)close();
         logger::Logger::error(logger::TCP, "ZephyrSocket::receivedCallback(): Error: %d", status);
     }
     if (pkt != nullptr)
     {
-        int len = net_pkt_remaining_data(pkt);
+#ifdef PLATFORM_SUPPORT_CAPTURE
+        if (_netContext != nullptr)
+        {
+            zethutils::captureTcpRxPayload(_netContext, pkt);
+        }
+#endif
+        size_t const len = net_pkt_remaining_data(pkt);
         k_fifo_put(&_receive_q, pkt);
-        _dataListener->dataReceived(len);
+        size_t notifyLength = 0U;
+        {
+            ::async::LockType const lock;
+            _receivedLength += len;
+            _unnotifiedLength += len;
+            if (_receivedLength >= _receiveThreshold)
+            {
+                notifyLength      = _unnotifiedLength;
+                _unnotifiedLength = 0U;
+            }
+        }
+        if (notifyLength == 0U)
+        {
+            // below the threshold
+        }
+        else if (_context != ::async::CONTEXT_INVALID)
+        {
+            notify(notifyLength, false);
+        }
+        else
+        {
+            notifyDataReceived(notifyLength);
+        }
     }
-    else
+    if ((pkt == nullptr) || (status != 0))
+    {
+        // EOF or error
+        if (_context != ::async::CONTEXT_INVALID)
+        {
+            // the listener may be using the socket in its context, it is closed there
+            notify(0U, true);
+        }
+        else
+        {
+            (void)close();
+            if (_dataListener != nullptr)
+            {
+                _dataListener->connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED);
+            }
+        }
+    }
+}
+
+void ZephyrSocket::notify(size_t const length, bool const closed)
+{
+    bool execute = false;
     {
-        // EOF
+        ::async::LockType const lock;
+        if ((_pendingPackets == 0U) && !_pendingClose)
+        {
+            _pendingTimestamp = k_cycle_get_32();
+        }
+        _pendingLength += length;
+        if (!closed)
+        {
+            ++_pendingPackets;
+        }
+        _pendingClose = _pendingClose || closed;
+        _deliveryStatistics.queued(_pendingPackets);
+        execute                  = !_notificationTaskPending;
+        _notificationTaskPending = true;
+    }
+    if (execute)
+    {
+        ::async::execute(_context, _notificationTask);
+    }
+}
+
+void ZephyrSocket::notificationTask()
+{
+    size_t length;
+    uint32_t packets;
+    uint32_t timestamp;
+    bool closed;
+    {
+        ::async::LockType const lock;
+        length                   = _pendingLength;
+        packets                  = _pendingPackets;
+        timestamp                = _pendingTimestamp;
+        closed                   = _pendingClose;
+        _pendingLength           = 0U;
+        _pendingPackets          = 0U;
+        _pendingClose            = false;
+        _notificationTaskPending = false;
+    }
+    _deliveryStatistics.delivered(packets + (closed ? 1U : 0U), k_cycle_get_32() - timestamp);
+    notifyDataReceived(length);
+    if (closed && (_netContext != nullptr))
+    {
+        // not notified if the listener has closed the socket itself in the meantime,
+        // the send buffer is offered to the stack once more, the peer may still receive
+        push();
         (void)close();
         if (_dataListener != nullptr)
         {
@@ -165,6 +348,27 @@ void ZephyrSocket::receivedCallback(struct net_context * /*ctx*/,
     }
 }
 
+void ZephyrSocket::notifyDataReceived(size_t length)
+{
+    if (_dataListener == nullptr)
+    {
+        return;
+    }
+    // notifications of several packets are coalesced, dataReceived() takes 16 bit
+    while (length > 0U)
+    {
+        uint16_t const chunk = (length > 0xFFFFU) ? 0xFFFFU : static_cast<uint16_t>(length);
+        _dataListener->dataReceived(chunk);
+        length -= chunk;
+    }
+}
+
+void ZephyrSocket::resetDeliveryStatistics()
+{
+    ::async::LockType const lock;
+    _deliveryStatistics = ::zethutils::DeliveryStatistics();
+}
+
 AbstractSocket::ErrorCode ZephyrSocket::close()
 {
     if (_netContext == nullptr)
@@ -172,8 +376,19 @@ AbstractSocket::ErrorCode ZephyrSocket::close()
         logger::Logger::debug(logger::TCP, "ZephyrSocket::close(): Socket already closed");
         return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
     }
+    // buffered data is dropped, close() may run in the RX thread without a context
+    _pushRetryTimeout.cancel();
+    _pushRetryPending = false;
+    _sendHead         = 0U;
+    {
+        ::async::LockType const lock;
+        _sendCount  = 0U;
+        _sendCredit = 0U;
+    }
     // Reset Callbacks
     (void)net_context_recv(_netContext, NULL, K_NO_WAIT, NULL);
+    // the packets not read are returned to the pool
+    discardData();
     if (net_context_put(_netContext) < 0)
     {
         logger::Logger::error(logger::TCP, "ZephyrSocket::close(): Error closing socket %p", _netContext);
@@ -190,92 +405,143 @@ void ZephyrSocket::abort()
 
 AbstractSocket::ErrorCode ZephyrSocket::flush()
 {
-    return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    if (_netContext == nullptr)
+    {
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+    push();
+    ::async::LockType const lock;
+    return (_sendCount == 0U) ? AbstractSocket::ErrorCode::SOCKET_ERR_OK
+                              : AbstractSocket::ErrorCode::SOCKET_ERR_NO_MORE_BUFFER;
 }
 
 uint8_t ZephyrSocket::read(uint8_t& byte)
 {
-    struct net_pkt* currentPkt = (net_pkt *)k_fifo_peek_head(&_receive_q);
-    if (currentPkt == nullptr)
-    {
-        return 0;
-    }
-    uint8_t value[1];
-    int res = net_pkt_read(currentPkt, &value[0], 1);
-    if (res == 0)    //read successful
-    {
-        byte = value[0];
-        if (net_pkt_remaining_data(currentPkt) == 0)
-        {
-            // If the packet is fully consumed, release it and update the receive window
-            (void)k_fifo_get(&_receive_q, K_NO_WAIT);
-            size_t fullPktLength = net_pkt_get_len(currentPkt);
-            net_pkt_unref(currentPkt);
-            net_context_update_recv_wnd(_netContext, fullPktLength);
-        }
-    }
-    else
+    ::etl::span<uint8_t const> const data = peek(1U);
+    if (data.empty())
     {
-        logger::Logger::error(logger::TCP, "ZephyrSocket::read(): Error reading byte: %d", res);
         return 0;
     }
-    return 1;
+    byte = data[0U];
+    return static_cast<uint8_t>(consume(1U));
 }
 
 size_t ZephyrSocket::read(uint8_t* buffer, size_t n)
 {
-    struct net_pkt* currentPkt = nullptr;
-    size_t bytes2Read = n;
-
-    while (bytes2Read > 0)
+    size_t bytesRead = 0U;
+    while (bytesRead < n)
     {
-        currentPkt = (net_pkt *)k_fifo_peek_head(&_receive_q);
+        struct net_pkt* const currentPkt = (net_pkt *)k_fifo_peek_head(&_receive_q);
         if (currentPkt == nullptr)
         {
-            // Return the number of bytes read so far
-            return n - bytes2Read;
+            break;
         }
         size_t bytes2ReadFromPkt = net_pkt_remaining_data(currentPkt);
-        int res;
-        if (bytes2Read < bytes2ReadFromPkt)
+        if (bytes2ReadFromPkt > (n - bytesRead))
         {
-            bytes2ReadFromPkt = bytes2Read;
+            bytes2ReadFromPkt = n - bytesRead;
         }
+        int res;
         if (buffer != nullptr)
         {
-            res = net_pkt_read(currentPkt, buffer, bytes2ReadFromPkt);
+            res = net_pkt_read(currentPkt, buffer + bytesRead, bytes2ReadFromPkt);
         }
         else
         {
             res = net_pkt_skip(currentPkt, bytes2ReadFromPkt);
         }
-        if (res == 0)    //read successful
+        if (res != 0)
         {
-            if (bytes2Read > bytes2ReadFromPkt)
-            {
-                bytes2Read -= bytes2ReadFromPkt;
-            }
-            else
-            {
-                bytes2Read = 0;
-            }
-            // If the packet is fully consumed, release it and update the receive window
-            if (net_pkt_remaining_data(currentPkt) == 0)
-            {
-                // dequeue packet
-                (void)k_fifo_get(&_receive_q, K_NO_WAIT);
-                size_t fullPktLength = net_pkt_get_len(currentPkt);
-                net_pkt_unref(currentPkt);
-                net_context_update_recv_wnd(_netContext, fullPktLength);
-            }
+            logger::Logger::error(logger::TCP, "ZephyrSocket::read(): Error reading packet: %d", res);
+            break;
         }
-        else
+        bytesRead += bytes2ReadFromPkt;
+        if (net_pkt_remaining_data(currentPkt) == 0)
         {
-            logger::Logger::error(logger::TCP, "ZephyrSocket::read(): Error reading packet: %d", res);
-            return 0;
+            // the packet is fully consumed
+            (void)k_fifo_get(&_receive_q, K_NO_WAIT);
+            net_pkt_unref(currentPkt);
+        }
+    }
+    {
+        ::async::LockType const lock;
+        _receivedLength -= bytesRead;
+    }
+    _windowUpdateLength += bytesRead;
+    // with nothing left to read the window must be fully open again
+    updateReceiveWindow(k_fifo_is_empty(&_receive_q) != 0);
+    return bytesRead;
+}
+
+::etl::span<uint8_t const> ZephyrSocket::peek(size_t const n)
+{
+    if ((n == 0U) || (n > _receivedLength))
+    {
+        // the caller waits for more data, which may need the window of the bytes read
+        updateReceiveWindow(true);
+        return ::etl::span<uint8_t const>();
+    }
+    struct net_pkt* pkt = (net_pkt *)k_fifo_peek_head(&_receive_q);
+    ::etl::span<uint8_t const> const data = contiguousData(pkt);
+    if (data.size() >= n)
+    {
+        return data.first(n);
+    }
+    if (n > MAX_PEEK_LENGTH)
+    {
+        return ::etl::span<uint8_t const>();
+    }
+    // the bytes continue in further buffers or packets, read them without moving the cursors
+    size_t gathered = 0U;
+    while ((pkt != nullptr) && (gathered < n))
+    {
+        size_t length = net_pkt_remaining_data(pkt);
+        if (length > (n - gathered))
+        {
+            length = n - gathered;
         }
+        struct net_pkt_cursor backup;
+        net_pkt_cursor_backup(pkt, &backup);
+        (void)net_pkt_read(pkt, &_peekBuffer[gathered], length);
+        net_pkt_cursor_restore(pkt, &backup);
+        gathered += length;
+        pkt = nextPacket(pkt);
+    }
+    return ::etl::span<uint8_t const>(_peekBuffer, gathered);
+}
+
+bool ZephyrSocket::isNotificationPending() const
+{
+    ::async::LockType const lock;
+    return _notificationTaskPending;
+}
+
+bool ZephyrSocket::setReceiveThreshold(size_t const length)
+{
+    bool available;
+    {
+        ::async::LockType const lock;
+        _receiveThreshold = (length > 0U) ? length : 1U;
+        available         = (_receivedLength >= _receiveThreshold);
+    }
+    if (!available)
+    {
+        updateReceiveWindow(true);
+    }
+    return available;
+}
+
+void ZephyrSocket::updateReceiveWindow(bool const force)
+{
+    if ((_windowUpdateLength >= RECEIVE_WINDOW_UPDATE_LENGTH)
+        || (force && (_windowUpdateLength > 0U)))
+    {
+        if (_netContext != nullptr)
+        {
+            net_context_update_recv_wnd(_netContext, static_cast<int32_t>(_windowUpdateLength));
+        }
+        _windowUpdateLength = 0U;
     }
-    return n;
 }
 
 void ZephyrSocket::discardData()
@@ -283,10 +549,15 @@ void ZephyrSocket::discardData()
     while (k_fifo_is_empty(&_receive_q) == 0)  // there are packets in the queue
     {
         struct net_pkt* currentPkt = (net_pkt *)k_fifo_get(&_receive_q, K_NO_WAIT);
-        size_t pktLength = net_pkt_get_len(currentPkt);
+        size_t const pktLength     = net_pkt_remaining_data(currentPkt);
         net_pkt_unref(currentPkt);
-        net_context_update_recv_wnd(_netContext, pktLength);
+        {
+            ::async::LockType const lock;
+            _receivedLength -= pktLength;
+        }
+        _windowUpdateLength += pktLength;
     }
+    updateReceiveWindow(true);
 }
 
 void ZephyrSocket::zeth_send_cb(struct net_context *context, int status, void *user_data)
@@ -299,7 +570,7 @@ void ZephyrSocket::sendCallback(struct net_context * /*context*/, int status)
 {
     logger::Logger::debug(logger::TCP, " ZephyrSocket::sendCallback(): status=%d", status);
 
-    if (status > 0)
+    if ((status > 0) && (_sendNotificationListener != nullptr))
     {
         _sendNotificationListener->dataSent(status, IDataSendNotificationListener::SendResult::DATA_SENT);
     }
@@ -312,27 +583,243 @@ AbstractSocket::ErrorCode ZephyrSocket::send(::etl::span<uint8_t const> const& d
         logger::Logger::error(logger::TCP, " ZephyrSocket::send(): socket not bound");
         return ErrorCode::SOCKET_ERR_NOT_OK;
     }
-    if (net_context_send(_netContext, data.data(), 
-        // contrary to documentation, returns number of bytes sent, or negative value on error
-                         data.size(), ZephyrSocket::zeth_send_cb, K_NO_WAIT /* timeout unused */, NULL ) < 0)
+    if (_sendBuffer.empty())
     {
-        return ErrorCode::SOCKET_ERR_NOT_OK;
+        // without a buffer nothing keeps an unsent tail, so the stack takes all data or nothing
+        int const res = sendAllToStack(data.data(), data.size());
+        if (res >= 0)
+        {
+            return ErrorCode::SOCKET_ERR_OK;
+        }
+        if (-EAGAIN != res)
+        {
+            return ErrorCode::SOCKET_ERR_NOT_OK;
+        }
+        if (data.size() > static_cast<size_t>(zeth_get_send_window(_netContext)))
+        {
+            // would never fit while nothing is in flight
+            logger::Logger::error(
+                logger::TCP,
+                " ZephyrSocket::send(): %u bytes exceed the send window, set a send buffer",
+                static_cast<unsigned int>(data.size()));
+            return ErrorCode::SOCKET_ERR_NOT_OK;
+        }
+        return ErrorCode::SOCKET_ERR_NO_MORE_BUFFER;
+    }
+    size_t sendCount;
+    {
+        ::async::LockType const lock;
+        sendCount = _sendCount;
+    }
+    if (data.size() > (_sendBuffer.size() - sendCount))
+    {
+        return ErrorCode::SOCKET_ERR_NO_MORE_BUFFER;
+    }
+    size_t const tail  = (_sendHead + sendCount) % _sendBuffer.size();
+    size_t const first = etl::min(data.size(), _sendBuffer.size() - tail);
+    (void)memcpy(&_sendBuffer[tail], data.data(), first);
+    (void)memcpy(&_sendBuffer[0U], data.data() + first, data.size() - first);
+    bool execute = false;
+    {
+        ::async::LockType const lock;
+        _sendCount += data.size();
+        if ((_scheduler == nullptr) && (_context != ::async::CONTEXT_INVALID))
+        {
+            // further writes of the current task are coalesced
+            execute          = !_pushTaskPending;
+            _pushTaskPending = true;
+        }
+    }
+    if (_scheduler != nullptr)
+    {
+        // pushed once the scheduler grants it
+        _scheduler->wakeUp();
+    }
+    else if (_context == ::async::CONTEXT_INVALID)
+    {
+        push();
+    }
+    else if (execute)
+    {
+        ::async::execute(_context, _pushTask);
     }
     return ErrorCode::SOCKET_ERR_OK;
 }
 
+size_t ZephyrSocket::sendToStack(uint8_t const* const data, size_t const length)
+{
+    // contrary to documentation, returns number of bytes queued, or negative value on error
+    int const res = net_context_send(
+        _netContext, data, length, ZephyrSocket::zeth_send_cb, K_NO_WAIT /* timeout unused */,
+        this);
+    if (res <= 0)
+    {
+        return 0U;
+    }
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    zethutils::captureTxPayload(
+        _netContext,
+        _netContext->remote,
+        IPPROTO_TCP,
+        ::etl::span<uint8_t const>(data, static_cast<size_t>(res)));
+#endif
+    return static_cast<size_t>(res);
+}
+
+int ZephyrSocket::sendAllToStack(uint8_t const* const data, size_t const length)
+{
+    int const res = zeth_tcp_send_all(_netContext, data, length, ZephyrSocket::zeth_send_cb, this);
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    if (res > 0)
+    {
+        zethutils::captureTxPayload(
+            _netContext,
+            _netContext->remote,
+            IPPROTO_TCP,
+            ::etl::span<uint8_t const>(data, length));
+    }
+#endif
+    return res;
+}
+
+void ZephyrSocket::push()
+{
+    size_t pushed = 0U;
+    size_t limit;
+    {
+        ::async::LockType const lock;
+        limit = (_scheduler != nullptr) ? _sendCredit : _sendCount;
+    }
+    bool windowFull = false;
+    while ((pushed < limit) && (_netContext != nullptr))
+    {
+        size_t const length   = etl::min(limit - pushed, _sendBuffer.size() - _sendHead);
+        size_t const accepted = sendToStack(&_sendBuffer[_sendHead], length);
+        _sendHead             = (_sendHead + accepted) % _sendBuffer.size();
+        {
+            ::async::LockType const lock;
+            _sendCount -= accepted;
+            _sendCredit -= (_scheduler != nullptr) ? accepted : 0U;
+        }
+        pushed += accepted;
+        if (accepted < length)
+        {
+            windowFull = true;
+            break;
+        }
+    }
+    bool empty;
+    {
+        ::async::LockType const lock;
+        empty = (_sendCount == 0U);
+    }
+    if (empty)
+    {
+        _sendHead = 0U;
+    }
+    else if (windowFull && (_context != ::async::CONTEXT_INVALID) && !_pushRetryPending)
+    {
+        _pushRetryPending = true;
+        ::async::schedule(
+            _context,
+            _pushRetryTask,
+            _pushRetryTimeout,
+            SEND_RETRY_MS,
+            ::async::TimeUnit::MILLISECONDS);
+    }
+    if ((pushed > 0U) && (_sendNotificationListener != nullptr))
+    {
+        // room for the producer
+        _sendNotificationListener->dataSent(
+            static_cast<uint16_t>(etl::min(pushed, static_cast<size_t>(0xFFFFU))),
+            IDataSendNotificationListener::SendResult::DATA_SENT);
+    }
+}
+
+void ZephyrSocket::pushTask()
+{
+    {
+        ::async::LockType const lock;
+        _pushTaskPending = false;
+    }
+    push();
+}
+
+void ZephyrSocket::pushRetryTask()
+{
+    _pushRetryPending = false;
+    push();
+}
+
+size_t ZephyrSocket::getUngrantedSendLength() const
+{
+    ::async::LockType const lock;
+    return _sendCount - _sendCredit;
+}
+
+void ZephyrSocket::grantSend(size_t const length)
+{
+    bool execute;
+    {
+        ::async::LockType const lock;
+        _sendCredit += length;
+        execute          = !_pushTaskPending;
+        _pushTaskPending = true;
+    }
+    if (execute)
+    {
+        ::async::execute(_context, _pushTask);
+    }
+}
+
+void ZephyrSocket::setPriority(uint8_t const priority)
+{
+    _priority = (priority < NET_MAX_PRIORITIES) ? priority
+                                                : static_cast<uint8_t>(NET_MAX_PRIORITIES - 1U);
+    applyPriority();
+}
+
+void ZephyrSocket::applyPriority()
+{
+#ifdef CONFIG_NET_CONTEXT_PRIORITY
+    if (_netContext == nullptr)
+    {
+        return;
+    }
+    int const ret = net_context_set_option(
+        _netContext, NET_OPT_PRIORITY, &_priority, sizeof(_priority));
+    if (ret < 0)
+    {
+        logger::Logger::error(logger::TCP, "ZephyrSocket::setPriority(): Failed: %d", ret);
+    }
+#endif
+}
+
+size_t ZephyrSocket::getSendWindowSpace() const
+{
+    return static_cast<size_t>(zeth_get_send_window_space(_netContext));
+}
+
 size_t ZephyrSocket::available()
 {
-    size_t totBufSize = CONFIG_NET_BUF_TX_COUNT * CONFIG_NET_BUF_DATA_SIZE;
-    size_t usedBufSize = zeth_get_send_data_total(_netContext);
-    return totBufSize - usedBufSize;
+    if (_netContext == nullptr)
+    {
+        return 0U;
+    }
+    if (!_sendBuffer.empty())
+    {
+        ::async::LockType const lock;
+        return _sendBuffer.size() - _sendCount;
+    }
+    return getSendWindowSpace();
 }
 
 AbstractSocket::ErrorCode ZephyrSocket::bind(ip::IPAddress const& ipAddr, uint16_t const port)
 {
     int ret;
-    sockaddr addr = zethutils::toSockAddr(&ipAddr, port);
-    ret = net_context_bind(_netContext, &addr, sizeof(addr));
+    sockaddr_storage addr;
+    socklen_t const addrLen = zethutils::toSockAddr(&ipAddr, port, addr);
+    ret = net_context_bind(_netContext, zethutils::toSockAddrPtr(addr), addrLen);
     if (ret < 0) {
         return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
     }
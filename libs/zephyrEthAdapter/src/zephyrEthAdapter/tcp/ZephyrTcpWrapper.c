@@ -35,6 +35,57 @@ int zeth_get_send_data_total(struct net_context *context)
     return tcp_state->send_data_total;
 }
 
+int zeth_get_send_window_space(struct net_context *context)
+{
+    // net_tcp_queue() takes no more than this, see tcp_window_full()
+    struct tcp *tcp_state = (struct tcp *)context->tcp;
+    int32_t window = tcp_state->send_win;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+    if (tcp_state->ca.cwnd < window)
+    {
+        window = tcp_state->ca.cwnd;
+    }
+#endif
+    int32_t space = window - (int32_t)tcp_state->send_data_total;
+    return (space > 0) ? space : 0;
+}
+
+int zeth_get_send_window(struct net_context *context)
+{
+    struct tcp *tcp_state = (struct tcp *)context->tcp;
+    int32_t window = tcp_state->send_win;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+    if (tcp_state->ca.cwnd < window)
+    {
+        window = tcp_state->ca.cwnd;
+    }
+#endif
+    return window;
+}
+
+int zeth_tcp_send_all(struct net_context *context,
+    const void *data, size_t len,
+    net_context_send_cb_t cb, void *user_data)
+{
+    // same lock order as net_context_send(), both mutexes are recursive, so the window can't
+    // shrink between the check and net_tcp_queue(), which then takes all of the data
+    struct tcp *tcp_state = (struct tcp *)context->tcp;
+    int ret;
+    k_mutex_lock(&context->lock, K_FOREVER);
+    k_mutex_lock(&tcp_state->lock, K_FOREVER);
+    if (len > (size_t)zeth_get_send_window_space(context))
+    {
+        ret = -EAGAIN;
+    }
+    else
+    {
+        ret = net_context_send(context, data, len, cb, K_NO_WAIT, user_data);
+    }
+    k_mutex_unlock(&tcp_state->lock);
+    k_mutex_unlock(&context->lock);
+    return ret;
+}
+
 int zeth_tcp_suspend(struct net_context *context, struct SocketSuspendContext *state)
 {
     struct tcp *tcp_state = context->tcp;
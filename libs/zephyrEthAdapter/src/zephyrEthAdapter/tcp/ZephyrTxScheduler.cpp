@@ -0,0 +1,241 @@
+// Copyright 2025 Accenture.
+
+#include "zephyrEthAdapter/tcp/ZephyrTxScheduler.h"
+
+#include <etl/algorithm.h>
+
+#include <zephyr/kernel.h>
+
+namespace tcp
+{
+size_t const ZephyrTxScheduler::CLASS_COUNT;
+size_t const ZephyrTxScheduler::MAX_SOCKETS;
+uint32_t const ZephyrTxScheduler::SCHEDULING_PERIOD_MS;
+uint32_t const ZephyrTxScheduler::MAX_SAVED_PERIODS;
+
+namespace
+{
+/**
+ * \return the priority of the rank, IEEE 802.1Q ranks background (NET_PRIORITY_BK, 1) below
+ *         best effort (NET_PRIORITY_BE, 0), the other priorities rank by their value
+ */
+uint8_t priorityOfRank(size_t const rank)
+{
+    return static_cast<uint8_t>((rank < 2U) ? (1U - rank) : rank);
+}
+} // namespace
+
+ZephyrTxScheduler::ZephyrTxScheduler(::async::ContextType const context, size_t const bytesPerMs)
+: _context(context)
+, _bytesPerMs(bytesPerMs)
+, _mode(Mode::STRICT)
+, _sockets()
+, _weights()
+, _granted()
+, _saturated(0U)
+, _budget(0U)
+, _refillTimestamp(k_uptime_get_32())
+, _nextSocket(0U)
+, _taskPending(false)
+, _periodPending(false)
+, _scheduleTask(
+      ::async::Function::CallType::create<ZephyrTxScheduler, &ZephyrTxScheduler::scheduleTask>(
+          *this))
+, _periodTask(
+      ::async::Function::CallType::create<ZephyrTxScheduler, &ZephyrTxScheduler::periodTask>(
+          *this))
+, _periodTimeout()
+{
+    for (size_t rank = 0U; rank < CLASS_COUNT; ++rank)
+    {
+        _weights[priorityOfRank(rank)] = static_cast<uint16_t>(rank + 1U);
+    }
+}
+
+bool ZephyrTxScheduler::add(ZephyrSocket& socket)
+{
+    // the granted data is pushed in the context of the socket
+    if (_sockets.full() || (::async::CONTEXT_INVALID == socket._context))
+    {
+        return false;
+    }
+    _sockets.push_back(&socket);
+    socket._scheduler = this;
+    return true;
+}
+
+void ZephyrTxScheduler::setWeight(uint8_t const priority, uint16_t const weight)
+{
+    if (priority < CLASS_COUNT)
+    {
+        _weights[priority] = (weight > 0U) ? weight : 1U;
+    }
+}
+
+void ZephyrTxScheduler::resetStatistics()
+{
+    for (uint32_t& granted : _granted)
+    {
+        granted = 0U;
+    }
+    _saturated = 0U;
+}
+
+void ZephyrTxScheduler::wakeUp()
+{
+    bool execute;
+    {
+        ::async::LockType const lock;
+        execute      = !_taskPending;
+        _taskPending = true;
+    }
+    if (execute)
+    {
+        ::async::execute(_context, _scheduleTask);
+    }
+}
+
+void ZephyrTxScheduler::scheduleTask()
+{
+    {
+        ::async::LockType const lock;
+        _taskPending = false;
+    }
+    schedule();
+}
+
+void ZephyrTxScheduler::periodTask()
+{
+    _periodPending = false;
+    schedule();
+}
+
+void ZephyrTxScheduler::schedule()
+{
+    if (_sockets.empty())
+    {
+        return;
+    }
+    refill();
+    switch (_mode)
+    {
+        case Mode::FIFO:
+        {
+            for (size_t priority = 0U; priority < CLASS_COUNT; ++priority)
+            {
+                (void)grantClass(static_cast<uint8_t>(priority), SIZE_MAX);
+            }
+            break;
+        }
+        case Mode::STRICT:
+        {
+            _budget -= grantStrict(_budget);
+            break;
+        }
+        case Mode::WEIGHTED:
+        {
+            _budget -= grantWeighted(_budget);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+    // the sockets of a class take turns in being served first
+    _nextSocket = (_nextSocket + 1U) % _sockets.size();
+
+    bool pending = false;
+    for (ZephyrSocket const* const socket : _sockets)
+    {
+        pending = pending || (socket->getUngrantedSendLength() > 0U);
+    }
+    if (pending && !_periodPending)
+    {
+        ++_saturated;
+        _periodPending = true;
+        ::async::schedule(
+            _context,
+            _periodTask,
+            _periodTimeout,
+            SCHEDULING_PERIOD_MS,
+            ::async::TimeUnit::MILLISECONDS);
+    }
+}
+
+void ZephyrTxScheduler::refill()
+{
+    uint32_t const now      = k_uptime_get_32();
+    uint32_t const elapsed  = now - _refillTimestamp;
+    uint32_t const maxSaved = SCHEDULING_PERIOD_MS * MAX_SAVED_PERIODS;
+    size_t const maxBudget  = _bytesPerMs * maxSaved;
+    _refillTimestamp        = now;
+    // the elapsed time is bounded first, so a long idle time can't overflow the budget
+    _budget = etl::min(_budget + (etl::min(elapsed, maxSaved) * _bytesPerMs), maxBudget);
+}
+
+size_t ZephyrTxScheduler::grantStrict(size_t const budget)
+{
+    size_t granted = 0U;
+    for (size_t rank = CLASS_COUNT; (rank > 0U) && (granted < budget); --rank)
+    {
+        granted += grantClass(priorityOfRank(rank - 1U), budget - granted);
+    }
+    return granted;
+}
+
+size_t ZephyrTxScheduler::grantWeighted(size_t const budget)
+{
+    size_t pending[CLASS_COUNT] = {};
+    for (ZephyrSocket const* const socket : _sockets)
+    {
+        pending[socket->getPriority()] += socket->getUngrantedSendLength();
+    }
+    uint32_t weightSum = 0U;
+    for (size_t priority = 0U; priority < CLASS_COUNT; ++priority)
+    {
+        if (pending[priority] > 0U)
+        {
+            weightSum += _weights[priority];
+        }
+    }
+    if (weightSum == 0U)
+    {
+        return 0U;
+    }
+    size_t granted = 0U;
+    for (size_t rank = CLASS_COUNT; rank > 0U; --rank)
+    {
+        uint8_t const priority = priorityOfRank(rank - 1U);
+        if (pending[priority] > 0U)
+        {
+            size_t const share = (budget * _weights[priority]) / weightSum;
+            granted += grantClass(priority, share);
+        }
+    }
+    // what a class didn't need, or the rounding left over
+    return granted + grantStrict(budget - granted);
+}
+
+size_t ZephyrTxScheduler::grantClass(uint8_t const priority, size_t const limit)
+{
+    size_t granted = 0U;
+    for (size_t i = 0U; (i < _sockets.size()) && (granted < limit); ++i)
+    {
+        ZephyrSocket& socket = *_sockets[(_nextSocket + i) % _sockets.size()];
+        if (socket.getPriority() != priority)
+        {
+            continue;
+        }
+        size_t const length = etl::min(socket.getUngrantedSendLength(), limit - granted);
+        if (length > 0U)
+        {
+            socket.grantSend(length);
+            granted += length;
+        }
+    }
+    _granted[priority] += static_cast<uint32_t>(granted);
+    return granted;
+}
+
+} // namespace tcp
@@ -0,0 +1,90 @@
+// Copyright 2025 Accenture.
+
+#include "zephyrEthAdapter/udp/ReceivedDatagram.h"
+
+#include <cstring>
+
+namespace udp
+{
+size_t const ReceivedDatagram::MAX_FRAGMENTS;
+
+ReceivedDatagram::ReceivedDatagram()
+: _pkt(nullptr), _fragments(), _fragmentCount(0U), _length(0U)
+{}
+
+bool ReceivedDatagram::init(struct net_pkt* const pkt)
+{
+    _pkt                = pkt;
+    _fragmentCount      = 0U;
+    _length             = net_pkt_remaining_data(pkt);
+    size_t remaining    = _length;
+    struct net_buf* buf = pkt->cursor.buf;
+    uint8_t* position   = pkt->cursor.pos;
+    while ((buf != nullptr) && (remaining > 0U))
+    {
+        size_t length = buf->len - static_cast<size_t>(position - buf->data);
+        if (length > remaining)
+        {
+            length = remaining;
+        }
+        if (length > 0U)
+        {
+            if (_fragmentCount == MAX_FRAGMENTS)
+            {
+                return false;
+            }
+            _fragments[_fragmentCount] = Fragment(position, length);
+            ++_fragmentCount;
+            remaining -= length;
+        }
+        buf = buf->frags;
+        if (buf != nullptr)
+        {
+            position = buf->data;
+        }
+    }
+    return true;
+}
+
+size_t ReceivedDatagram::copy(size_t offset, uint8_t* const buffer, size_t const n) const
+{
+    size_t copied = 0U;
+    for (size_t i = 0U; (i < _fragmentCount) && (copied < n); ++i)
+    {
+        Fragment const& fragment = _fragments[i];
+        if (offset >= fragment.size())
+        {
+            offset -= fragment.size();
+            continue;
+        }
+        size_t length = fragment.size() - offset;
+        if (length > (n - copied))
+        {
+            length = n - copied;
+        }
+        (void)memcpy(buffer + copied, fragment.data() + offset, length);
+        copied += length;
+        offset = 0U;
+    }
+    return copied;
+}
+
+ReceivedDatagram ReceivedDatagram::retain() const
+{
+    if (_pkt != nullptr)
+    {
+        (void)net_pkt_ref(_pkt);
+    }
+    return *this;
+}
+
+void ReceivedDatagram::release()
+{
+    if (_pkt != nullptr)
+    {
+        net_pkt_unref(_pkt);
+    }
+    *this = ReceivedDatagram();
+}
+
+} // namespace udp
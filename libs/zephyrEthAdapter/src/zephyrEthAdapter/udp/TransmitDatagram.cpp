@@ -0,0 +1,75 @@
+// Copyright 2025 Accenture.
+
+#include "zephyrEthAdapter/udp/TransmitDatagram.h"
+
+#include <cstring>
+
+namespace udp
+{
+size_t const TransmitDatagram::MAX_FRAGMENTS;
+
+TransmitDatagram::TransmitDatagram()
+: _pkt(nullptr), _fragments(), _fragmentCount(0U), _length(0U)
+{}
+
+bool TransmitDatagram::init(struct net_pkt* const pkt, size_t const length)
+{
+    _pkt                = pkt;
+    _fragmentCount      = 0U;
+    _length             = length;
+    size_t remaining    = length;
+    // the headers occupy the start of the first buffer, the payload follows them
+    struct net_buf* buf = pkt->buffer;
+    while ((buf != nullptr) && (remaining > 0U))
+    {
+        size_t n = net_buf_tailroom(buf);
+        if (n > remaining)
+        {
+            n = remaining;
+        }
+        if (n > 0U)
+        {
+            if (_fragmentCount == MAX_FRAGMENTS)
+            {
+                return false;
+            }
+            _fragments[_fragmentCount] = Fragment(static_cast<uint8_t*>(net_buf_add(buf, n)), n);
+            ++_fragmentCount;
+            remaining -= n;
+        }
+        buf = buf->frags;
+    }
+    return remaining == 0U;
+}
+
+size_t TransmitDatagram::write(size_t offset, uint8_t const* const buffer, size_t const n)
+{
+    size_t written = 0U;
+    for (size_t i = 0U; (i < _fragmentCount) && (written < n); ++i)
+    {
+        Fragment const& fragment = _fragments[i];
+        if (offset >= fragment.size())
+        {
+            offset -= fragment.size();
+            continue;
+        }
+        size_t length = fragment.size() - offset;
+        if (length > (n - written))
+        {
+            length = n - written;
+        }
+        (void)memcpy(fragment.data() + offset, buffer + written, length);
+        written += length;
+        offset = 0U;
+    }
+    return written;
+}
+
+struct net_pkt* TransmitDatagram::release()
+{
+    struct net_pkt* const pkt = _pkt;
+    *this                     = TransmitDatagram();
+    return pkt;
+}
+
+} // namespace udp
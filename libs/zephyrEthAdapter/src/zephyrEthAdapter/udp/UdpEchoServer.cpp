@@ -3,17 +3,36 @@
 #include "zephyrEthAdapter/udp/UdpEchoServer.h"
 
 #include <ip/to_str.h>
+#include <udp/DatagramPacket.h>
 #include <udp/UdpLogger.h>
 
+#include <zephyr/kernel.h>
+
+#include <etl/vector.h>
+
 namespace udp
 {
 
 using ::util::logger::Logger;
 using ::util::logger::UDP;
 
+size_t const UdpEchoServer::QUEUE_CAPACITY;
+size_t const UdpEchoServer::BATCH_CAPACITY;
+size_t const UdpEchoServer::BATCH_SIZE;
+uint32_t const UdpEchoServer::BATCH_WINDOW_MS;
+
 UdpEchoServer::UdpEchoServer(
     ip::IPAddress const& ipAddr, uint16_t const rxPort, ::async::ContextType asyncContext)
-: _ipAddr(ipAddr), _rxPort(rxPort), _socket(), _receiveData(), _context(asyncContext)
+: _ipAddr(ipAddr)
+, _rxPort(rxPort)
+, _socket()
+, _receiveData()
+, _context(asyncContext)
+, _statistics()
+, _batched(false)
+, _multicastGroup()
+, _queue()
+, _batch()
 {}
 
 bool UdpEchoServer::start()
@@ -21,10 +40,17 @@ bool UdpEchoServer::start()
     Logger::info(UDP, "UDP Echo server initialisation");
 
     _socket.setDataListener(this);
+    _socket.setDatagramListener(this);
+    _socket.setContext(_context, _queue);
+    _socket.setBatchListener(
+        _batched ? this : nullptr, _context, _batch, BATCH_SIZE, BATCH_WINDOW_MS);
     if (_socket.bind(&_ipAddr, _rxPort) == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
     {
-        _socket.setDataListener(this);
         Logger::info(UDP, "Listening on port %d.", _rxPort);
+        if (_multicastGroup.has_value())
+        {
+            (void)_socket.join(*_multicastGroup);
+        }
         return true;
     }
 
@@ -37,6 +63,28 @@ void UdpEchoServer::stop()
     _socket.close();
 }
 
+void UdpEchoServer::resetStatistics()
+{
+    _statistics = Statistics();
+    _socket.resetDeliveryStatistics();
+}
+
+void UdpEchoServer::setBatched(bool const batched)
+{
+    stop();
+    _batched = batched;
+    (void)start();
+}
+
+void UdpEchoServer::setMulticastGroup(::ip::IPAddress const& group)
+{
+    _multicastGroup = group;
+    if (_socket.isBound())
+    {
+        (void)_socket.join(group);
+    }
+}
+
 void UdpEchoServer::dataReceived(
     ::udp::AbstractDatagramSocket& /*socket*/,
     ::ip::IPAddress sourceAddress,
@@ -51,8 +99,100 @@ void UdpEchoServer::dataReceived(
     }
 
     (void)_socket.read(&_receiveData[0U], length);
+    echo(&_receiveData[0U], length, sourceAddress, sourcePort);
+}
+
+void UdpEchoServer::datagramReceived(
+    ZephyrDatagramSocket& /*socket*/,
+    ::ip::IPAddress sourceAddress,
+    uint16_t sourcePort,
+    ReceivedDatagram const& datagram)
+{
+    ::etl::span<ReceivedDatagram::Fragment const> const fragments = datagram.getFragments();
+    if (fragments.size() == 1U)
+    {
+        echo(
+            fragments[0U].data(),
+            static_cast<uint16_t>(fragments[0U].size()),
+            sourceAddress,
+            sourcePort);
+        return;
+    }
+
+    // the fragments are gathered directly into the network buffers of the reply
+    uint32_t const start = k_cycle_get_32();
+    TransmitDatagram reply;
+    ::udp::AbstractDatagramSocket::ErrorCode result
+        = _socket.allocate(sourceAddress, sourcePort, datagram.getLength(), reply);
+    if (result == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
+    {
+        size_t length = 0U;
+        for (ReceivedDatagram::Fragment const& fragment : fragments)
+        {
+            length += reply.write(length, fragment.data(), fragment.size());
+        }
+        result = _socket.commit(reply, length);
+    }
+    ++_statistics._gathered;
+    recordSend(
+        k_cycle_get_32() - start,
+        1U,
+        (result == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK) ? 0U : 1U);
+}
+
+void UdpEchoServer::datagramsReceived(
+    ZephyrDatagramSocket& socket, ::etl::span<DatagramBatchEntry const> const datagrams)
+{
+    ++_statistics._batches;
+    ::etl::vector<::udp::DatagramPacket, BATCH_CAPACITY> replies;
+    for (DatagramBatchEntry const& entry : datagrams)
+    {
+        ::etl::span<ReceivedDatagram::Fragment const> const fragments
+            = entry._datagram.getFragments();
+        if (fragments.size() == 1U)
+        {
+            replies.emplace_back(
+                fragments[0U].data(),
+                static_cast<uint16_t>(fragments[0U].size()),
+                entry._sourceAddress,
+                entry._sourcePort);
+        }
+        else
+        {
+            datagramReceived(socket, entry._sourceAddress, entry._sourcePort, entry._datagram);
+        }
+    }
+    uint32_t const start = k_cycle_get_32();
+    size_t const sent    = _socket.sendBatch(
+        ::etl::span<::udp::DatagramPacket const>(replies.data(), replies.size()));
+    recordSend(k_cycle_get_32() - start, replies.size(), replies.size() - sent);
+}
+
+void UdpEchoServer::echo(
+    uint8_t const* const data,
+    uint16_t const length,
+    ::ip::IPAddress const& address,
+    uint16_t const port)
+{
     Logger::debug(UDP, "Echoing back %d bytes.", length);
-    (void)_socket.send(::udp::DatagramPacket(&_receiveData[0U], length, sourceAddress, sourcePort));
+    uint32_t const start = k_cycle_get_32();
+    ::udp::AbstractDatagramSocket::ErrorCode const result
+        = _socket.send(::udp::DatagramPacket(data, length, address, port));
+    recordSend(
+        k_cycle_get_32() - start,
+        1U,
+        (result == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK) ? 0U : 1U);
+}
+
+void UdpEchoServer::recordSend(uint32_t const cycles, size_t const echoes, size_t const errors)
+{
+    _statistics._echoes += echoes;
+    _statistics._sendErrors += errors;
+    _statistics._sendCycles += cycles;
+    if (cycles > _statistics._maxSendCycles)
+    {
+        _statistics._maxSendCycles = cycles;
+    }
 }
 
 } // namespace udp
@@ -1,9 +1,18 @@
 // Copyright 2025 Accenture.
 
 #include "zephyrEthAdapter/udp/ZephyrDatagramSocket.h"
+#include <zephyr/kernel.h>
+#include <zephyr/net/igmp.h>
+#include <zephyr/net/mld.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
 #include <zephyr/net/net_pkt.h>
 
+#include "zephyrEthAdapter/udp/ZephyrUdpWrapper.h"
 #include "zephyrEthAdapter/utils/EthHelper.h"
+#ifdef PLATFORM_SUPPORT_CAPTURE
+#include "zephyrEthAdapter/utils/EthCapture.h"
+#endif
 
 #include <ip/to_str.h>
 #include <udp/DatagramPacket.h>
@@ -15,9 +24,60 @@ namespace udp
 namespace logger = ::util::logger;
 using ::ip::IPAddress;
 
+namespace
+{
+bool isMulticast(sockaddr_storage& addr)
+{
+    if (addr.ss_family == AF_INET)
+    {
+        return net_ipv4_is_addr_mcast(&net_sin(zethutils::toSockAddrPtr(addr))->sin_addr);
+    }
+    return net_ipv6_is_addr_mcast(&net_sin6(zethutils::toSockAddrPtr(addr))->sin6_addr);
+}
+
+/** membership of an interface in a group, shared by the sockets which joined it */
+struct Membership
+{
+    IPAddress _address;
+    struct net_if* _iface;
+    size_t _users;
+    /** false if the interface was member already, it is left to whoever joined it */
+    bool _joined;
+};
+
+/** shared by the sockets of all contexts, changed under lock */
+::etl::vector<Membership, ZephyrDatagramSocket::MAX_MEMBERSHIPS> memberships;
+
+Membership* findMembership(IPAddress const& group, struct net_if* const iface)
+{
+    for (Membership& membership : memberships)
+    {
+        if ((membership._address == group) && (membership._iface == iface))
+        {
+            return &membership;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
 ZephyrDatagramSocket::ZephyrDatagramSocket()
 : AbstractDatagramSocket(), _socket(-1), _netContext(nullptr), _currentPkt(nullptr),
-    _isBound(false), _isConnected(false)
+    _isBound(false), _isConnected(false), _captured(true), _datagramListener(nullptr),
+    _datagram(), _fragmentedDrops(0U), _batchListener(nullptr),
+    _batchContext(::async::CONTEXT_INVALID), _batch(), _batchSize(0U), _batchWindowMs(0U),
+    _batchCount(0U), _batchDelivering(0U), _batchTaskPending(false), _batchWindowPending(false), _batchDrops(0U),
+    _batchTask(::async::Function::CallType::create<
+               ZephyrDatagramSocket, &ZephyrDatagramSocket::batchTask>(*this)),
+    _batchWindowTask(::async::Function::CallType::create<
+                     ZephyrDatagramSocket, &ZephyrDatagramSocket::batchWindowTask>(*this)),
+    _batchTimeout(), _context(::async::CONTEXT_INVALID), _queue(), _queueHead(0U),
+    _queueCount(0U), _queueTaskPending(false),
+    _queueTask(::async::Function::CallType::create<
+               ZephyrDatagramSocket, &ZephyrDatagramSocket::queueTask>(*this)),
+    _deliveryStatistics(), _multicastGroups(), _multicastIface(nullptr), _peerAddrLen(0U),
+    _localIpAddress(), _destinationIpAddress(), _destinationPort(0U), _destinationAddrLen(0U),
+    _destinationAddr()
 {}
 
 bool ZephyrDatagramSocket::isBound() const { return _isBound; }
@@ -50,9 +110,10 @@ ZephyrDatagramSocket::bind(ip::IPAddress const* pIpAddress, uint16_t port)
         return ErrorCode::UDP_SOCKET_NOT_OK;
     }
 
-    sockaddr addr = zethutils::toSockAddr(pIpAddress, port);
+    sockaddr_storage addr;
+    socklen_t const addrLen = zethutils::toSockAddr(pIpAddress, port, addr);
 
-    res = net_context_bind(_netContext, &addr, sizeof(addr));
+    res = net_context_bind(_netContext, zethutils::toSockAddrPtr(addr), addrLen);
     if (res < 0)
     {
         net_context_put(_netContext);
@@ -68,7 +129,8 @@ ZephyrDatagramSocket::bind(ip::IPAddress const* pIpAddress, uint16_t port)
     }
 
     _localAddr.emplace(addr);
-    _isBound = true;
+    _localIpAddress = *pIpAddress;
+    _isBound        = true;
     return ErrorCode::UDP_SOCKET_OK;
 }
 
@@ -104,23 +166,492 @@ void ZephyrDatagramSocket::receivedCallback(struct net_context * /*ctx*/,
     {
         srcAddr = ip::make_ip6(ip_hdr->ipv6->src);
     }
-    _currentPkt = pkt;
-    _dataListener->dataReceived(
-        *this,
-        srcAddr,
-        ntohs(proto_hdr->udp->src_port),
-        zethutils::fromSockAddr(*_localAddr),
-        net_pkt_remaining_data(pkt));
-    _currentPkt = nullptr;
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    if (_captured)
+    {
+        zethutils::captureRxPacket(pkt);
+    }
+#endif
+    if (_batchListener != nullptr)
+    {
+        addToBatch(srcAddr, ntohs(proto_hdr->udp->src_port), pkt);
+    }
+    else if (_context != ::async::CONTEXT_INVALID)
+    {
+        enqueue(srcAddr, ntohs(proto_hdr->udp->src_port), pkt);
+    }
+    else
+    {
+        deliver(srcAddr, ntohs(proto_hdr->udp->src_port), pkt);
+    }
     net_pkt_unref(pkt);
 }
 
-AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::join(ip::IPAddress const& /*groupAddr*/)
+void ZephyrDatagramSocket::deliver(
+    ip::IPAddress const& sourceAddress, uint16_t const sourcePort, struct net_pkt* const pkt)
+{
+    if (_datagramListener != nullptr)
+    {
+        if (_datagram.init(pkt))
+        {
+            _datagramListener->datagramReceived(*this, sourceAddress, sourcePort, _datagram);
+        }
+        else
+        {
+            ++_fragmentedDrops;
+        }
+    }
+    else if (_dataListener != nullptr)
+    {
+        _currentPkt = pkt;
+        _dataListener->dataReceived(
+            *this,
+            sourceAddress,
+            sourcePort,
+            _localIpAddress,
+            net_pkt_remaining_data(pkt));
+        _currentPkt = nullptr;
+    }
+}
+
+void ZephyrDatagramSocket::setContext(
+    ::async::ContextType const context, ::etl::span<QueuedDatagram> const queue)
+{
+    releaseQueue();
+    ::async::LockType const lock;
+    _queue   = queue;
+    _context = context;
+}
+
+void ZephyrDatagramSocket::resetDeliveryStatistics()
+{
+    ::async::LockType const lock;
+    _deliveryStatistics = ::zethutils::DeliveryStatistics();
+}
+
+void ZephyrDatagramSocket::enqueue(
+    ip::IPAddress const& sourceAddress, uint16_t const sourcePort, struct net_pkt* const pkt)
+{
+    bool execute = false;
+    {
+        ::async::LockType const lock;
+        if (_queueCount == _queue.size())
+        {
+            ++_deliveryStatistics._drops;
+            return;
+        }
+        QueuedDatagram& entry = _queue[(_queueHead + _queueCount) % _queue.size()];
+        entry._pkt            = net_pkt_ref(pkt);
+        entry._sourceAddress  = sourceAddress;
+        entry._sourcePort     = sourcePort;
+        entry._timestamp      = k_cycle_get_32();
+        ++_queueCount;
+        _deliveryStatistics.queued(static_cast<uint32_t>(_queueCount));
+        execute           = !_queueTaskPending;
+        _queueTaskPending = true;
+    }
+    if (execute)
+    {
+        ::async::execute(_context, _queueTask);
+    }
+}
+
+void ZephyrDatagramSocket::queueTask()
+{
+    {
+        ::async::LockType const lock;
+        _queueTaskPending = false;
+    }
+    while (true)
+    {
+        QueuedDatagram entry;
+        {
+            ::async::LockType const lock;
+            if (_queueCount == 0U)
+            {
+                return;
+            }
+            entry      = _queue[_queueHead];
+            _queueHead = (_queueHead + 1U) % _queue.size();
+            --_queueCount;
+        }
+        _deliveryStatistics.delivered(1U, k_cycle_get_32() - entry._timestamp);
+        deliver(entry._sourceAddress, entry._sourcePort, entry._pkt);
+        net_pkt_unref(entry._pkt);
+    }
+}
+
+void ZephyrDatagramSocket::releaseQueue()
+{
+    // queueTask() may run concurrently, entries it has taken out are released by it
+    ::async::LockType const lock;
+    for (; _queueCount > 0U; --_queueCount)
+    {
+        net_pkt_unref(_queue[_queueHead]._pkt);
+        _queueHead = (_queueHead + 1U) % _queue.size();
+    }
+    _queueHead = 0U;
+}
+
+void ZephyrDatagramSocket::setBatchListener(
+    IDatagramBatchListener* const listener,
+    ::async::ContextType const context,
+    ::etl::span<DatagramBatchEntry> const storage,
+    size_t const batchSize,
+    uint32_t const windowMs)
+{
+    releaseBatch();
+    _batchContext  = context;
+    _batch         = storage;
+    _batchSize
+        = ((batchSize > 0U) && (batchSize < storage.size())) ? batchSize : storage.size();
+    _batchWindowMs = windowMs;
+    _batchListener = listener;
+}
+
+void ZephyrDatagramSocket::addToBatch(
+    ip::IPAddress const& sourceAddress, uint16_t const sourcePort, struct net_pkt* const pkt)
+{
+    if (!_datagram.init(pkt))
+    {
+        ++_fragmentedDrops;
+        return;
+    }
+    bool execute = false;
+    {
+        ::async::LockType const lock;
+        if (_batchCount == _batch.size())
+        {
+            ++_batchDrops;
+            return;
+        }
+        DatagramBatchEntry& entry = _batch[_batchCount];
+        entry._sourceAddress      = sourceAddress;
+        entry._sourcePort         = sourcePort;
+        entry._datagram           = _datagram.retain();
+        ++_batchCount;
+        // the window is scheduled by the batch task, timeouts belong to the batch context
+        bool const full        = _batchCount >= _batchSize;
+        bool const startWindow = (_batchCount == 1U) && !_batchWindowPending;
+        execute                = (full || startWindow) && !_batchTaskPending;
+        _batchTaskPending      = _batchTaskPending || execute;
+    }
+    if (execute)
+    {
+        ::async::execute(_batchContext, _batchTask);
+    }
+}
+
+void ZephyrDatagramSocket::batchTask()
+{
+    bool deliver     = false;
+    bool startWindow = false;
+    {
+        ::async::LockType const lock;
+        _batchTaskPending   = false;
+        deliver             = _batchCount >= _batchSize;
+        startWindow         = !deliver && (_batchCount > 0U) && !_batchWindowPending;
+        _batchWindowPending = _batchWindowPending || startWindow;
+    }
+    if (deliver)
+    {
+        deliverBatch();
+    }
+    else if (startWindow)
+    {
+        scheduleBatchWindow();
+    }
+}
+
+void ZephyrDatagramSocket::batchWindowTask()
+{
+    {
+        ::async::LockType const lock;
+        _batchWindowPending = false;
+    }
+    deliverBatch();
+}
+
+void ZephyrDatagramSocket::deliverBatch()
+{
+    size_t count;
+    {
+        ::async::LockType const lock;
+        count = (_batchListener != nullptr) ? _batchCount : 0U;
+        // releaseBatch() leaves these entries to the delivery
+        _batchDelivering = count;
+    }
+    if (count == 0U)
+    {
+        return;
+    }
+    // the RX thread only appends behind count, so these entries are stable
+    _batchListener->datagramsReceived(
+        *this, ::etl::span<DatagramBatchEntry const>(_batch.data(), count));
+    for (size_t i = 0U; i < count; ++i)
+    {
+        _batch[i]._datagram.release();
+    }
+    bool startWindow = false;
+    {
+        ::async::LockType const lock;
+        _batchDelivering = 0U;
+        // datagrams which arrived during the delivery move to the front
+        for (size_t i = count; i < _batchCount; ++i)
+        {
+            _batch[i - count] = _batch[i];
+        }
+        _batchCount -= count;
+
+        startWindow         = (_batchCount > 0U) && !_batchWindowPending;
+        _batchWindowPending = _batchWindowPending || startWindow;
+    }
+    if (startWindow)
+    {
+        scheduleBatchWindow();
+    }
+}
+
+void ZephyrDatagramSocket::scheduleBatchWindow()
+{
+    ::async::schedule(
+        _batchContext,
+        _batchWindowTask,
+        _batchTimeout,
+        _batchWindowMs,
+        ::async::TimeUnit::MILLISECONDS);
+}
+
+void ZephyrDatagramSocket::releaseBatch()
+{
+    _batchTimeout.cancel();
+    // close() may run while the batch context delivers, which releases its entries itself
+    ::async::LockType const lock;
+    for (size_t i = _batchDelivering; i < _batchCount; ++i)
+    {
+        _batch[i]._datagram.release();
+    }
+    _batchCount         = _batchDelivering;
+    _batchWindowPending = false;
+}
+
+AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::join(ip::IPAddress const& groupAddr)
+{
+    if (_netContext == nullptr)
+    {
+        logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::join(): socket not bound!");
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    struct net_if* const iface = getMulticastInterface();
+    for (MulticastGroup const& group : _multicastGroups)
+    {
+        if ((group._address == groupAddr) && (group._iface == iface))
+        {
+            return ErrorCode::UDP_SOCKET_OK;
+        }
+    }
+    if (_multicastGroups.full())
+    {
+        logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::join(): too many groups!");
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    int const res = acquireMembership(groupAddr, iface);
+    if (res < 0)
+    {
+        logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::join(): failed: %d", res);
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    _multicastGroups.push_back(MulticastGroup{groupAddr, iface});
+    return ErrorCode::UDP_SOCKET_OK;
+}
+
+AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::leave(ip::IPAddress const& groupAddr)
+{
+    if (_netContext == nullptr)
+    {
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    struct net_if* const iface = getMulticastInterface();
+    for (auto it = _multicastGroups.begin(); it != _multicastGroups.end(); ++it)
+    {
+        if ((it->_address == groupAddr) && (it->_iface == iface))
+        {
+            releaseMembership(it->_address, it->_iface);
+            (void)_multicastGroups.erase(it);
+            return ErrorCode::UDP_SOCKET_OK;
+        }
+    }
+    return ErrorCode::UDP_SOCKET_NOT_OK;
+}
+
+void ZephyrDatagramSocket::leaveAll()
+{
+    for (MulticastGroup const& group : _multicastGroups)
+    {
+        releaseMembership(group._address, group._iface);
+    }
+    _multicastGroups.clear();
+}
+
+int ZephyrDatagramSocket::acquireMembership(
+    ip::IPAddress const& group, struct net_if* const iface)
+{
+    {
+        ::async::LockType const lock;
+        Membership* const membership = findMembership(group, iface);
+        if (membership != nullptr)
+        {
+            ++membership->_users;
+            return 0;
+        }
+        if (memberships.full())
+        {
+            return -ENOMEM;
+        }
+        // counted before the join, so a socket joining meanwhile doesn't join again
+        memberships.push_back(Membership{group, iface, 1U, false});
+    }
+    int const res = updateMembership(group, iface, true);
+    if ((res < 0) && (res != -EALREADY))
+    {
+        releaseMembership(group, iface);
+        return res;
+    }
+    ::async::LockType const lock;
+    Membership* const membership = findMembership(group, iface);
+    if (membership != nullptr)
+    {
+        membership->_joined = (res != -EALREADY);
+    }
+    return 0;
+}
+
+void ZephyrDatagramSocket::releaseMembership(
+    ip::IPAddress const& group, struct net_if* const iface)
 {
-    // Not implemented
+    bool leaveGroup = false;
+    {
+        ::async::LockType const lock;
+        Membership* const membership = findMembership(group, iface);
+        if (membership == nullptr)
+        {
+            return;
+        }
+        --membership->_users;
+        if (membership->_users > 0U)
+        {
+            return;
+        }
+        leaveGroup = membership->_joined;
+        (void)memberships.erase(membership);
+    }
+    if (leaveGroup)
+    {
+        (void)updateMembership(group, iface, false);
+    }
+}
+
+AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::setMulticastTtl(uint8_t const ttl)
+{
+    if (_netContext == nullptr)
+    {
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    if (_addressFamily == ip::IPAddress::IPV4)
+    {
+        net_context_set_ipv4_mcast_ttl(_netContext, ttl);
+    }
+    else
+    {
+        net_context_set_ipv6_mcast_hop_limit(_netContext, ttl);
+    }
     return ErrorCode::UDP_SOCKET_OK;
 }
 
+AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::setMulticastInterface(int const ifIndex)
+{
+    if (_netContext == nullptr)
+    {
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    struct net_if* iface = nullptr;
+    if (ifIndex > 0)
+    {
+        iface = net_if_get_by_index(ifIndex);
+        if (iface == nullptr)
+        {
+            return ErrorCode::UDP_SOCKET_NOT_OK;
+        }
+    }
+    _multicastIface = iface;
+    return ErrorCode::UDP_SOCKET_OK;
+}
+
+AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::setPriority(uint8_t const priority)
+{
+#ifdef CONFIG_NET_CONTEXT_PRIORITY
+    if ((_netContext == nullptr) || (priority >= NET_MAX_PRIORITIES))
+    {
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    int const res
+        = net_context_set_option(_netContext, NET_OPT_PRIORITY, &priority, sizeof(priority));
+    if (res < 0)
+    {
+        logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::setPriority(): failed: %d", res);
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    return ErrorCode::UDP_SOCKET_OK;
+#else
+    (void)priority;
+    return ErrorCode::UDP_SOCKET_NOT_OK;
+#endif
+}
+
+struct net_if* ZephyrDatagramSocket::getMulticastInterface() const
+{
+    if (_multicastIface != nullptr)
+    {
+        return _multicastIface;
+    }
+    struct net_if* const iface = net_context_get_iface(_netContext);
+    return (iface != nullptr) ? iface : net_if_get_default();
+}
+
+int ZephyrDatagramSocket::updateMembership(
+    ip::IPAddress const& group, struct net_if* const iface, bool const join)
+{
+    sockaddr_storage addr;
+    (void)zethutils::toSockAddr(&group, 0U, addr);
+    if (addr.ss_family == AF_INET)
+    {
+#if defined(CONFIG_NET_IPV4_IGMP)
+        struct in_addr const* const groupAddr = &net_sin(zethutils::toSockAddrPtr(addr))->sin_addr;
+        if (!net_ipv4_is_addr_mcast(groupAddr))
+        {
+            return -EINVAL;
+        }
+        return join ? net_ipv4_igmp_join(iface, groupAddr, nullptr)
+                    : net_ipv4_igmp_leave(iface, groupAddr);
+#endif
+    }
+    else
+    {
+#if defined(CONFIG_NET_IPV6_MLD)
+        struct in6_addr const* const groupAddr
+            = &net_sin6(zethutils::toSockAddrPtr(addr))->sin6_addr;
+        if (!net_ipv6_is_addr_mcast(groupAddr))
+        {
+            return -EINVAL;
+        }
+        return join ? net_ipv6_mld_join(iface, groupAddr) : net_ipv6_mld_leave(iface, groupAddr);
+#endif
+    }
+    (void)iface;
+    (void)join;
+    return -ENOTSUP;
+}
+
 size_t ZephyrDatagramSocket::read(uint8_t* buffer, size_t n)
 {
     if (_currentPkt == nullptr)
@@ -156,8 +687,9 @@ AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::connect(
         logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::connect(): socket not bound!");
         return ErrorCode::UDP_SOCKET_NOT_OK;
     }
-    _peerAddr.emplace(zethutils::toSockAddr(&address, port));
-    if (net_context_connect(_netContext, (struct sockaddr*)&(*_peerAddr), sizeof(*_peerAddr), NULL, K_NO_WAIT, NULL) < 0)
+    _peerAddr.emplace();
+    _peerAddrLen = zethutils::toSockAddr(&address, port, *_peerAddr);
+    if (net_context_connect(_netContext, zethutils::toSockAddrPtr(*_peerAddr), _peerAddrLen, NULL, K_NO_WAIT, NULL) < 0)
     {
         return ErrorCode::UDP_SOCKET_NOT_OK;
     }
@@ -165,7 +697,7 @@ AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::connect(
 
     if (pLocalAddress && _localAddr.has_value())
     {
-        *pLocalAddress = zethutils::fromSockAddr(*_localAddr);
+        *pLocalAddress = _localIpAddress;
     }
     return ErrorCode::UDP_SOCKET_OK;
 }
@@ -198,6 +730,13 @@ ZephyrDatagramSocket::send(::etl::span<uint8_t const> const& data)
     {
         return ErrorCode::UDP_SOCKET_NOT_OK;
     }
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    if (_captured)
+    {
+        zethutils::captureTxPayload(
+            _netContext, zethutils::toSockAddrRef(*_peerAddr), IPPROTO_UDP, data);
+    }
+#endif
     return ErrorCode::UDP_SOCKET_OK;
 }
 
@@ -208,21 +747,155 @@ AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::send(DatagramPacket cons
         logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::send(): socket not bound!");
         return ErrorCode::UDP_SOCKET_NOT_OK;
     }
-    ip::IPAddress ip           = packet.getAddress();
-    ip::IPAddress const* ipPtr = &ip;
-    sockaddr destAddr       = zethutils::toSockAddr(ipPtr, packet.getPort());
+    return sendTo(packet);
+}
+
+size_t ZephyrDatagramSocket::sendBatch(::etl::span<DatagramPacket const> const packets)
+{
+    if (_netContext == nullptr)
+    {
+        logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::sendBatch(): socket not bound!");
+        return 0U;
+    }
+    size_t sent = 0U;
+    for (DatagramPacket const& packet : packets)
+    {
+        if (sendTo(packet) != ErrorCode::UDP_SOCKET_OK)
+        {
+            break;
+        }
+        ++sent;
+    }
+    return sent;
+}
+
+AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::sendTo(DatagramPacket const& packet)
+{
+    setDestination(packet.getAddress(), packet.getPort());
+    if ((_multicastIface != nullptr) && isMulticast(_destinationAddr))
+    {
+        // net_context_sendto() routes by the destination, the packet is built for the interface
+        TransmitDatagram datagram;
+        ErrorCode result
+            = allocate(packet.getAddress(), packet.getPort(), packet.getLength(), datagram);
+        if (result == ErrorCode::UDP_SOCKET_OK)
+        {
+            (void)datagram.write(0U, packet.getData(), packet.getLength());
+            result = commit(datagram, packet.getLength());
+        }
+        return result;
+    }
 
     if (net_context_sendto(_netContext, packet.getData(), 
                            packet.getLength(), 
-                           &destAddr,
-                           sizeof(destAddr),
+                           zethutils::toSockAddrPtr(_destinationAddr),
+                           _destinationAddrLen,
                            NULL, K_NO_WAIT /* timeout unused */, NULL ) != 0)
     {
         return ErrorCode::UDP_SOCKET_NOT_OK;
     }
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    if (_captured)
+    {
+        zethutils::captureTxPayload(
+            _netContext,
+            zethutils::toSockAddrRef(_destinationAddr),
+            IPPROTO_UDP,
+            ::etl::span<uint8_t const>(packet.getData(), packet.getLength()));
+    }
+#endif
+    return ErrorCode::UDP_SOCKET_OK;
+}
+
+AbstractDatagramSocket::ErrorCode ZephyrDatagramSocket::allocate(
+    ip::IPAddress const& address,
+    uint16_t const port,
+    size_t const length,
+    TransmitDatagram& datagram)
+{
+    if (_netContext == nullptr)
+    {
+        logger::Logger::error(logger::UDP, " ZephyrDatagramSocket::allocate(): socket not bound!");
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    setDestination(address, port);
+    struct net_pkt* const pkt = zeth_udp_alloc(
+        _netContext,
+        zethutils::toSockAddrPtr(_destinationAddr),
+        _multicastIface,
+        length,
+        K_NO_WAIT);
+    if (pkt == nullptr)
+    {
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    if (!datagram.init(pkt, length))
+    {
+        (void)datagram.release();
+        net_pkt_unref(pkt);
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
     return ErrorCode::UDP_SOCKET_OK;
 }
 
+AbstractDatagramSocket::ErrorCode
+ZephyrDatagramSocket::commit(TransmitDatagram& datagram, size_t const length)
+{
+    size_t const allocatedLength = datagram.getLength();
+    struct net_pkt* const pkt    = datagram.release();
+    if (pkt == nullptr)
+    {
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    int res = (length <= allocatedLength) ? 0 : -EINVAL;
+    if ((res == 0) && (length < allocatedLength))
+    {
+        // trims the unused end of the payload
+        res = net_pkt_update_length(pkt, net_pkt_get_len(pkt) - (allocatedLength - length));
+    }
+    if (res == 0)
+    {
+        res = zeth_udp_finalize(pkt);
+    }
+    if (res < 0)
+    {
+        net_pkt_unref(pkt);
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    if (_captured)
+    {
+        zethutils::captureTxPacket(pkt);
+    }
+#endif
+    if (net_send_data(pkt) < 0)
+    {
+        net_pkt_unref(pkt);
+        return ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    return ErrorCode::UDP_SOCKET_OK;
+}
+
+void ZephyrDatagramSocket::discard(TransmitDatagram& datagram)
+{
+    struct net_pkt* const pkt = datagram.release();
+    if (pkt != nullptr)
+    {
+        net_pkt_unref(pkt);
+    }
+}
+
+void ZephyrDatagramSocket::setDestination(ip::IPAddress const& address, uint16_t const port)
+{
+    if ((_destinationAddrLen == 0U) || (port != _destinationPort)
+        || !(address == _destinationIpAddress))
+    {
+        _destinationAddrLen   = zethutils::toSockAddr(&address, port, _destinationAddr);
+        _destinationIpAddress = address;
+        _destinationPort      = port;
+    }
+}
+
 void ZephyrDatagramSocket::close()
 {
     if (_netContext == nullptr)
@@ -232,6 +905,8 @@ void ZephyrDatagramSocket::close()
     }
     // Reset Callbacks
     (void)net_context_recv(_netContext, NULL, K_NO_WAIT, NULL);
+    leaveAll();
+    _multicastIface = nullptr;
     if (net_context_put(_netContext) < 0)
     {
         logger::Logger::error(logger::UDP, "ZephyrDatagramSocket::close(): Error closing socket %p", _netContext);
@@ -242,6 +917,10 @@ void ZephyrDatagramSocket::close()
     _isConnected = false;
     _localAddr.reset();
     _peerAddr.reset();
+    _destinationAddrLen = 0U;
+    // no more datagrams arrive, the pending ones are given back to the stack
+    releaseBatch();
+    releaseQueue();
 
     logger::Logger::debug(logger::UDP, "ZephyrDatagramSocket::close(): Socket %p closed", _netContext);
 }
@@ -250,7 +929,6 @@ ip::IPAddress const* ZephyrDatagramSocket::getIPAddress() const
 {
     if (_localAddr.has_value())
     {
-        static ip::IPAddress _localIpAddress = zethutils::fromSockAddr(*_localAddr);
         return &_localIpAddress;
     }
     return nullptr;
@@ -0,0 +1,126 @@
+// Copyright 2025 Accenture.
+
+#include <../subsys/net/ip/ipv4.h>
+#include <../subsys/net/ip/ipv6.h>
+#include <../subsys/net/ip/udp_internal.h>
+#include "zephyrEthAdapter/udp/ZephyrUdpWrapper.h"
+
+#include <zephyr/net/net_if.h>
+
+static struct net_pkt* zeth_udp_alloc_ipv4(struct net_context *context,
+    const struct sockaddr_in *dst, struct net_if *mcast_iface,
+    size_t length, k_timeout_t timeout)
+{
+    const struct in_addr *src = net_sin_ptr(&context->local)->sin_addr;
+    bool mcast = net_ipv4_is_addr_mcast(&dst->sin_addr);
+    struct net_if *iface = (mcast && (mcast_iface != NULL))
+        ? mcast_iface : net_if_ipv4_select_src_iface(&dst->sin_addr);
+    struct net_pkt *pkt;
+
+    if (iface == NULL)
+    {
+        return NULL;
+    }
+    if ((src == NULL) || net_ipv4_is_addr_unspecified(src))
+    {
+        src = net_if_ipv4_select_src_addr(iface, &dst->sin_addr);
+    }
+    pkt = net_pkt_alloc_with_buffer(iface, length, AF_INET, IPPROTO_UDP, timeout);
+    if (pkt == NULL)
+    {
+        return NULL;
+    }
+    net_pkt_set_context(pkt, context);
+    if (mcast)
+    {
+        net_pkt_set_ipv4_ttl(pkt, net_context_get_ipv4_mcast_ttl(context));
+    }
+    if ((net_ipv4_create(pkt, src, &dst->sin_addr) < 0)
+        || (net_udp_create(pkt, net_sin_ptr(&context->local)->sin_port, dst->sin_port) < 0))
+    {
+        net_pkt_unref(pkt);
+        return NULL;
+    }
+    return pkt;
+}
+
+static struct net_pkt* zeth_udp_alloc_ipv6(struct net_context *context,
+    const struct sockaddr_in6 *dst, struct net_if *mcast_iface,
+    size_t length, k_timeout_t timeout)
+{
+    const struct in6_addr *src = net_sin6_ptr(&context->local)->sin6_addr;
+    bool mcast = net_ipv6_is_addr_mcast(&dst->sin6_addr);
+    struct net_if *iface = (mcast && (mcast_iface != NULL))
+        ? mcast_iface : net_if_ipv6_select_src_iface(&dst->sin6_addr);
+    struct net_pkt *pkt;
+
+    if (iface == NULL)
+    {
+        return NULL;
+    }
+    if ((src == NULL) || net_ipv6_is_addr_unspecified(src))
+    {
+        src = net_if_ipv6_select_src_addr(iface, &dst->sin6_addr);
+    }
+    pkt = net_pkt_alloc_with_buffer(iface, length, AF_INET6, IPPROTO_UDP, timeout);
+    if (pkt == NULL)
+    {
+        return NULL;
+    }
+    net_pkt_set_context(pkt, context);
+    if (mcast)
+    {
+        net_pkt_set_ipv6_hop_limit(pkt, net_context_get_ipv6_mcast_hop_limit(context));
+    }
+    if ((net_ipv6_create(pkt, src, &dst->sin6_addr) < 0)
+        || (net_udp_create(pkt, net_sin6_ptr(&context->local)->sin6_port, dst->sin6_port) < 0))
+    {
+        net_pkt_unref(pkt);
+        return NULL;
+    }
+    return pkt;
+}
+
+struct net_pkt* zeth_udp_alloc(struct net_context *context,
+    const struct sockaddr *dst, struct net_if *mcast_iface,
+    size_t length, k_timeout_t timeout)
+{
+    struct net_pkt *pkt = NULL;
+
+    if (IS_ENABLED(CONFIG_NET_IPV4) && (dst->sa_family == AF_INET))
+    {
+        pkt = zeth_udp_alloc_ipv4(context, net_sin(dst), mcast_iface, length, timeout);
+    }
+    else if (IS_ENABLED(CONFIG_NET_IPV6) && (dst->sa_family == AF_INET6))
+    {
+        pkt = zeth_udp_alloc_ipv6(context, net_sin6(dst), mcast_iface, length, timeout);
+    }
+#if defined(CONFIG_NET_CONTEXT_PRIORITY)
+    if (pkt != NULL)
+    {
+        /* net_context_sendto() does the same for the packets it allocates */
+        uint8_t priority = 0U;
+        size_t len = sizeof(priority);
+
+        if (net_context_get_option(context, NET_OPT_PRIORITY, &priority, &len) == 0)
+        {
+            net_pkt_set_priority(pkt, priority);
+        }
+    }
+#endif
+    return pkt;
+}
+
+int zeth_udp_finalize(struct net_pkt *pkt)
+{
+    net_pkt_cursor_init(pkt);
+    if (IS_ENABLED(CONFIG_NET_IPV4) && (net_pkt_family(pkt) == AF_INET))
+    {
+        return net_ipv4_finalize(pkt, IPPROTO_UDP);
+    }
+    if (IS_ENABLED(CONFIG_NET_IPV6) && (net_pkt_family(pkt) == AF_INET6))
+    {
+        return net_ipv6_finalize(pkt, IPPROTO_UDP);
+    }
+    return -EAFNOSUPPORT;
+}
@@ -0,0 +1,65 @@
+# Copyright 2025 Accenture.
+
+# Measures the CAN throughput of demo_app on native_sim per bus and in total:
+# ISO-TP first frames on 0x6F1 are sent on all buses at once and answered with a flow
+# control frame on 0x6F9 by a frame listener in the task of each bus.
+# Usage: python3 can_throughput_test.py [interface ...], default vcan0 vcan1.
+# Compare a build with the default canBusConfigs in src/main.cpp (one task per bus) with
+# a build where all buses run in TASK_CAN.
+
+import socket
+import struct
+import sys
+import threading
+import time
+
+CAN_FRAME_FORMAT = '=IB3x8s'
+REQUEST_ID = 0x6F1
+RESPONSE_ID = 0x6F9
+DURATION_S = 10
+# requests in flight per bus, keeps the RX queue of the transceiver from overflowing
+WINDOW = 8
+
+# first frame of a 20 byte message
+FIRST_FRAME = bytes([0x10, 0x14, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06])
+REQUEST = struct.pack(CAN_FRAME_FORMAT, REQUEST_ID, 8, FIRST_FRAME)
+
+def load_bus(interface, results):
+    s = socket.socket(socket.AF_CAN, socket.SOCK_RAW, socket.CAN_RAW)
+    s.bind((interface,))
+    s.settimeout(0.1)
+    responses = 0
+    timeouts = 0
+    for _ in range(WINDOW):
+        s.send(REQUEST)
+    end = time.perf_counter() + DURATION_S
+    while time.perf_counter() < end:
+        try:
+            frame = s.recv(16)
+        except TimeoutError:
+            # a request or its response got lost, refill the window
+            timeouts += 1
+            s.send(REQUEST)
+            continue
+        can_id, _, _ = struct.unpack(CAN_FRAME_FORMAT, frame)
+        if can_id == RESPONSE_ID:
+            responses += 1
+            s.send(REQUEST)
+    results[interface] = (responses, timeouts)
+    s.close()
+
+interfaces = sys.argv[1:] or ['vcan0', 'vcan1']
+results = {}
+threads = [threading.Thread(target=load_bus, args=(i, results)) for i in interfaces]
+for thread in threads:
+    thread.start()
+for thread in threads:
+    thread.join()
+
+total = 0
+for interface in interfaces:
+    responses, timeouts = results[interface]
+    total += responses
+    print(f'{interface}: {responses / DURATION_S:.0f} frames/s, {timeouts} timeouts')
+print(f'total: {total / DURATION_S:.0f} frames/s')
+sys.exit(0 if all(results[i][0] > 0 for i in interfaces) else 1)
@@ -0,0 +1,119 @@
+# Copyright 2025 Accenture.
+
+# Generates a C++ header with ::bios::CanMessage and ::bios::CanSignal types
+# (libs/bspZephyr/include/can/signal/CanSignal.h) from the messages and signals
+# of a DBC file. Multiplexed signals and multiplexer switches, value tables and
+# attributes are ignored. Generation fails if a factor or offset doesn't fit into
+# the int32_t parameters of ::bios::CanScaledSignal.
+#
+# usage: python3 dbc_to_signals.py <dbc file> <header> <namespace>
+# e.g.:  python3 dbc_to_signals.py demo.dbc include/app/DemoCanSignals.h demo::signals
+
+import math
+import os
+import re
+import sys
+from fractions import Fraction
+
+MESSAGE = re.compile(r'^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)')
+SIGNAL = re.compile(
+    r'^\s+SG_\s+(\w+)\s*([mM]\d*)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*'
+    r'\(\s*([^,]+)\s*,\s*([^)]+)\s*\)\s*\[[^\]]*\]\s*"([^"]*)"')
+EXTENDED_ID_FLAG = 0x80000000
+MAX_DENOMINATOR = 1000000
+INT32_MIN = -(1 << 31)
+INT32_MAX = (1 << 31) - 1
+
+
+def parse(path):
+    messages = []
+    with open(path, encoding='latin-1') as dbc:
+        for line in dbc:
+            match = MESSAGE.match(line)
+            if match:
+                messages.append({
+                    'id': int(match.group(1)),
+                    'name': match.group(2),
+                    'length': int(match.group(3)),
+                    'signals': []})
+                continue
+            match = SIGNAL.match(line)
+            # the codecs don't select by the multiplexer value
+            if match and messages and not match.group(2):
+                messages[-1]['signals'].append({
+                    'name': match.group(1),
+                    'start': int(match.group(3)),
+                    'length': int(match.group(4)),
+                    'motorola': match.group(5) == '0',
+                    'signed': match.group(6) == '-',
+                    'factor': Fraction(match.group(7).strip()).limit_denominator(MAX_DENOMINATOR),
+                    'offset': Fraction(match.group(8).strip()).limit_denominator(MAX_DENOMINATOR),
+                    'unit': match.group(9)})
+    return messages
+
+
+def signal_type(message, signal):
+    order = 'MOTOROLA' if signal['motorola'] else 'INTEL'
+    raw = '::bios::CanSignal<{}U, {}U, ::bios::CanByteOrder::{}{}>'.format(
+        signal['start'], signal['length'], order, ', true' if signal['signed'] else '')
+    factor = signal['factor']
+    offset = signal['offset']
+    if (factor == 1) and (offset == 0):
+        return raw
+    denominator = (factor.denominator * offset.denominator) // math.gcd(
+        factor.denominator, offset.denominator)
+    parameters = [
+        factor.numerator * (denominator // factor.denominator),
+        denominator,
+        offset.numerator * (denominator // offset.denominator)]
+    if (factor == 0) or any((p < INT32_MIN) or (p > INT32_MAX) for p in parameters):
+        raise ValueError('{}.{}: factor {} and offset {} don\'t fit into int32_t'.format(
+            message['name'], signal['name'], factor, offset))
+    return '::bios::CanScaledSignal<\n        {},\n        {},\n        {},\n        {}>'.format(
+        raw, *parameters)
+
+
+def generate(messages, source, namespace):
+    lines = [
+        '// Copyright 2025 Accenture.',
+        '',
+        '// Generated by dbc_to_signals.py from {}, do not edit.'.format(source),
+        '',
+        '#pragma once',
+        '',
+        '#include <can/canframes/CanId.h>',
+        '#include <can/signal/CanSignal.h>',
+        '']
+    for name in namespace.split('::'):
+        lines += ['namespace {}'.format(name), '{']
+    for message in messages:
+        extended = (message['id'] & EXTENDED_ID_FLAG) != 0
+        raw_id = message['id'] & ~EXTENDED_ID_FLAG
+        lines += [
+            '/** 0x{:X} */'.format(raw_id),
+            'struct {}'.format(message['name']),
+            ': ::bios::CanMessage<::can::CanId::id(0x{:X}U, {}), {}U>'.format(
+                raw_id, 'true' if extended else 'false', message['length']),
+            '{']
+        for signal in message['signals']:
+            if signal['unit']:
+                lines.append('    /** [{}] */'.format(signal['unit']))
+            lines.append(
+                '    using {} = {};'.format(signal['name'], signal_type(message, signal)))
+        lines += ['};', '']
+    for name in reversed(namespace.split('::')):
+        lines.append('}} // namespace {}'.format(name))
+    return '\n'.join(lines) + '\n'
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 4:
+        print('usage: {} <dbc file> <header> <namespace>'.format(sys.argv[0]))
+        sys.exit(1)
+    try:
+        header = generate(parse(sys.argv[1]), os.path.basename(sys.argv[1]), sys.argv[3])
+    except ValueError as error:
+        print('error: {}'.format(error))
+        sys.exit(1)
+    with open(sys.argv[2], 'w') as output:
+        output.write(header)
@@ -0,0 +1,64 @@
+# Copyright 2025 Accenture.
+
+# Test of the framed TCP echo server of demo_app on native_sim: sends frames of a 16 bit big
+# endian length followed by the payload, keeps a window of frames in flight and checks that
+# every frame is echoed unchanged. Random lengths make frames straddle the TCP segments.
+#
+# usage: python3 echo_test_tcp_framed.py [frames] [window]
+
+import random
+import socket
+import struct
+import sys
+import time
+
+TARGET = '192.0.2.1', 1235
+MAX_PAYLOAD_LENGTH = 1024
+RECV_BUF_SIZE = 65535
+
+
+def frame(i):
+    length = random.randint(0, MAX_PAYLOAD_LENGTH)
+    payload = bytes((i + j) & 0xFF for j in range(length))
+    return struct.pack('>H', length) + payload
+
+
+def run(count, window):
+    s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    s.bind(('192.0.2.2', 0))
+    s.connect(TARGET)
+    s.settimeout(2)
+    pending = []
+    received = b''
+    sent = 0
+    echoed = 0
+    errors = 0
+    start = time.time()
+    while echoed < count:
+        while (sent < count) and (len(pending) < window):
+            data = frame(sent)
+            s.sendall(data)
+            pending.append(data)
+            sent += 1
+        try:
+            received += s.recv(RECV_BUF_SIZE)
+        except TimeoutError:
+            print(f'timeout after {echoed} frames')
+            break
+        while pending and len(received) >= len(pending[0]):
+            expected = pending.pop(0)
+            if received[:len(expected)] != expected:
+                errors += 1
+            received = received[len(expected):]
+            echoed += 1
+    duration = time.time() - start
+    s.close()
+    print(f'{echoed} of {count} frames echoed in {duration:.1f} s: '
+          f'{echoed / duration:.0f} frames/s, {errors} corrupted')
+    return (echoed == count) and (errors == 0)
+
+
+if __name__ == '__main__':
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+    window = int(sys.argv[2]) if len(sys.argv) > 2 else 8
+    sys.exit(0 if run(count, window) else 1)
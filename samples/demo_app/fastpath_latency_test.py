@@ -0,0 +1,58 @@
+# Copyright 2025 Accenture.
+
+# Compares the ISO-TP flow control round trip of demo_app on native_sim:
+# the first frame on 0x6F0 is answered on 0x6F8 by a fast path handler in the RX interrupt,
+# the first frame on 0x6F1 is answered on 0x6F9 by a frame listener in the CAN task.
+
+import socket
+import struct
+import sys
+import time
+
+INTERFACE = 'vcan0'
+CAN_FRAME_FORMAT = '=IB3x8s'
+NUM_FRAMES = 1000
+
+# first frame of a 20 byte message
+FIRST_FRAME = bytes([0x10, 0x14, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06])
+FLOW_CONTROL_TYPE = 0x30
+
+# (name, request id, response id)
+PATHS = [('fast path', 0x6F0, 0x6F8), ('task', 0x6F1, 0x6F9)]
+
+s = socket.socket(socket.AF_CAN, socket.SOCK_RAW, socket.CAN_RAW)
+s.bind((INTERFACE,))
+s.settimeout(1)
+
+def round_trip_test(name, request_id, response_id):
+    latencies = []
+    lost = 0
+    for i in range(NUM_FRAMES):
+        start = time.perf_counter_ns()
+        s.send(struct.pack(CAN_FRAME_FORMAT, request_id, 8, FIRST_FRAME))
+        while True:
+            try:
+                frame = s.recv(16)
+            except TimeoutError:
+                lost += 1
+                break
+            can_id, length, data = struct.unpack(CAN_FRAME_FORMAT, frame)
+            if can_id == response_id and (data[0] & 0xF0) == FLOW_CONTROL_TYPE:
+                latencies.append(time.perf_counter_ns() - start)
+                break
+    if not latencies:
+        print(f'{name}: no flow control received')
+        return False
+    latencies.sort()
+    us = lambda ns: ns / 1000
+    print(f'{name}: {len(latencies)} round trips, {lost} lost, '
+          f'latency us min {us(latencies[0]):.1f} '
+          f'avg {us(sum(latencies) / len(latencies)):.1f} '
+          f'p99 {us(latencies[len(latencies) * 99 // 100]):.1f} '
+          f'max {us(latencies[-1]):.1f}')
+    return lost == 0
+
+ok = True
+for name, request_id, response_id in PATHS:
+    ok = round_trip_test(name, request_id, response_id) and ok
+sys.exit(0 if ok else 1)
@@ -0,0 +1,61 @@
+# Copyright 2025 Accenture.
+
+# Measures the CAN gateway latency of demo_app on native_sim built with
+# -DOPENBSW_CAN_GATEWAY=ON and boards/native_sim_multican.overlay:
+# frames are sent on vcan0 and the routed frames are received on vcan1.
+
+import socket
+import struct
+import sys
+import time
+
+SOURCE_INTERFACE = 'vcan0'
+DESTINATION_INTERFACE = 'vcan1'
+CAN_FRAME_FORMAT = '=IB3x8s'
+NUM_FRAMES = 1000
+
+# (sent id, expected id on the destination bus)
+ROUTES = [(0x205, 0x205), (0x300, 0x301), (0x385, 0x485)]
+
+def open_socket(interface):
+    s = socket.socket(socket.AF_CAN, socket.SOCK_RAW, socket.CAN_RAW)
+    s.bind((interface,))
+    s.settimeout(1)
+    return s
+
+source = open_socket(SOURCE_INTERFACE)
+destination = open_socket(DESTINATION_INTERFACE)
+
+def latency_test(sent_id, expected_id):
+    latencies = []
+    lost = 0
+    for i in range(NUM_FRAMES):
+        payload = struct.pack('<Q', i)
+        start = time.perf_counter_ns()
+        source.send(struct.pack(CAN_FRAME_FORMAT, sent_id, 8, payload))
+        while True:
+            try:
+                frame = destination.recv(16)
+            except TimeoutError:
+                lost += 1
+                break
+            can_id, length, data = struct.unpack(CAN_FRAME_FORMAT, frame)
+            if can_id == expected_id and data == payload:
+                latencies.append(time.perf_counter_ns() - start)
+                break
+    if not latencies:
+        print(f'0x{sent_id:x} -> 0x{expected_id:x}: no frame routed')
+        return False
+    latencies.sort()
+    us = lambda ns: ns / 1000
+    print(f'0x{sent_id:x} -> 0x{expected_id:x}: {len(latencies)} frames, {lost} lost, '
+          f'latency us min {us(latencies[0]):.1f} '
+          f'avg {us(sum(latencies) / len(latencies)):.1f} '
+          f'p99 {us(latencies[len(latencies) * 99 // 100]):.1f} '
+          f'max {us(latencies[-1]):.1f}')
+    return lost == 0
+
+ok = True
+for sent_id, expected_id in ROUTES:
+    ok = latency_test(sent_id, expected_id) and ok
+sys.exit(0 if ok else 1)
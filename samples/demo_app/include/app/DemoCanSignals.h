@@ -0,0 +1,59 @@
+// Copyright 2025 Accenture.
+
+// Generated by dbc_to_signals.py from demo.dbc, do not edit.
+
+#pragma once
+
+#include <can/canframes/CanId.h>
+#include <can/signal/CanSignal.h>
+
+namespace demo
+{
+namespace signals
+{
+/** 0x558 */
+struct DemoCounter
+: ::bios::CanMessage<::can::CanId::id(0x558U, false), 4U>
+{
+    using Counter = ::bios::CanSignal<7U, 32U, ::bios::CanByteOrder::MOTOROLA>;
+};
+
+/** 0x559 */
+struct DemoStatus1
+: ::bios::CanMessage<::can::CanId::id(0x559U, false), 8U>
+{
+    using AliveCounter = ::bios::CanSignal<0U, 8U, ::bios::CanByteOrder::INTEL>;
+};
+
+/** 0x55A */
+struct DemoStatus2
+: ::bios::CanMessage<::can::CanId::id(0x55AU, false), 8U>
+{
+    using AliveCounter = ::bios::CanSignal<0U, 8U, ::bios::CanByteOrder::INTEL>;
+};
+
+/** 0x55B */
+struct DemoStatus3
+: ::bios::CanMessage<::can::CanId::id(0x55BU, false), 8U>
+{
+    using AliveCounter = ::bios::CanSignal<0U, 8U, ::bios::CanByteOrder::INTEL>;
+};
+
+/** 0x18FEF100 */
+struct CCVS1
+: ::bios::CanMessage<::can::CanId::id(0x18FEF100U, true), 8U>
+{
+    using TwoSpeedAxleSwitch = ::bios::CanSignal<0U, 2U, ::bios::CanByteOrder::INTEL>;
+    using ParkingBrakeSwitch = ::bios::CanSignal<2U, 2U, ::bios::CanByteOrder::INTEL>;
+    /** [km/h] */
+    using WheelBasedVehicleSpeed = ::bios::CanScaledSignal<
+        ::bios::CanSignal<8U, 16U, ::bios::CanByteOrder::INTEL>,
+        1,
+        256,
+        0>;
+    using CruiseControlActive = ::bios::CanSignal<24U, 2U, ::bios::CanByteOrder::INTEL>;
+    using BrakeSwitch = ::bios::CanSignal<28U, 2U, ::bios::CanByteOrder::INTEL>;
+};
+
+} // namespace signals
+} // namespace demo
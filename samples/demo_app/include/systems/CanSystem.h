@@ -2,12 +2,22 @@
 
 #pragma once
 
+#include "can/gateway/CanRouter.h"
+#include "can/monitor/CanRxDeadlineMonitor.h"
+#include "can/scheduler/CanTxScheduler.h"
 #include "can/transceiver/ZephyrCanTransceiver.h"
 #include "lifecycle/SingleContextLifecycleComponent.h"
 
+#include <console/AsyncCommandWrapper.h>
+#include <lifecycle/console/CanStatisticsCommand.h>
+#ifdef PLATFORM_SUPPORT_CAN_BENCHMARK
+#include <lifecycle/console/CanBenchmarkCommand.h>
+#endif
 #include <systems/ICanSystem.h>
 
 #include <etl/singleton_base.h>
+#include <etl/span.h>
+#include <etl/vector.h>
 
 class StaticBsp;
 
@@ -18,12 +28,60 @@ class CanSystem
 : public ::can::ICanSystem
 , public ::lifecycle::SingleContextLifecycleComponent
 , public ::etl::singleton_base<CanSystem>
+, private ::async::IRunnable
 {
 public:
+    /** Maximum number of CAN buses, one bus ID per bus starting with ::busid::CAN_0. */
+    static constexpr size_t MAX_CAN_BUSES = ::busid::LAST_CAN - ::busid::CAN_0 + 1U;
+
+    /** Closed range of extended CAN IDs. */
+    struct ExtendedIdRange
+    {
+        uint32_t _firstId;
+        uint32_t _lastId;
+    };
+
+    /** Gateway route of the frames received on a bus, see ::bios::CanRouter::addRoute(). */
+    struct Route
+    {
+        uint32_t _firstId;
+        uint32_t _lastId;
+        bool _extended;
+        /** bus ID of the destination bus */
+        uint8_t _destination;
+        uint32_t _rewriteId;
+        uint32_t _rewriteMask;
+    };
+
+    /**
+     * Configuration of one CAN bus supplied by the application.
+     */
+    struct BusConfig
+    {
+        /** async context of the transceiver */
+        ::async::ContextType _context;
+        /** J1939 PGNs of the extended frames delivered to the listeners */
+        ::etl::span<uint32_t const> _acceptedPgns;
+        /** ranges of extended IDs delivered to the listeners */
+        ::etl::span<ExtendedIdRange const> _acceptedExtendedIds;
+        /** router of the frames received on the bus, nullptr if they are not routed */
+        ::bios::CanRouter* _router;
+        /** routes added to _router */
+        ::etl::span<Route const> _routes;
+    };
+
     /**
      * \param context The context in which the CanSystem will run which is unit8_t.
      */
     CanSystem(::async::ContextType const context);
+
+    /**
+     * \param context    The context in which the CanSystem will run which is unit8_t.
+     * \param busConfigs Configuration of each bus in the order of the CAN bus list in the
+     *                   devicetree. Buses without an entry run in \p context, drop all
+     *                   extended frames and are not routed.
+     */
+    CanSystem(::async::ContextType const context, ::etl::span<BusConfig const> busConfigs);
     CanSystem(CanSystem const&)            = delete;
     CanSystem& operator=(CanSystem const&) = delete;
 
@@ -36,31 +94,69 @@ public:
 
     /**
      * Runs the CanSystem.
-     * Enables CanRxRunnable, initialize and open CanFlex2Transceiver which setup and open CAN
-     * connection, then invoke transitionDone to update lifecycle manager that the component has
-     * completed its transition.
+     * Initializes and opens all transceivers which sets up and opens the CAN connections, then
+     * invokes transitionDone to update lifecycle manager that the component has completed its
+     * transition.
      */
     void run() override;
 
     /**
      * Shutdowns the CanSystem.
-     * Close and shutdowns CanFlex2Transceiver which will cancel the CAN connection, disables
-     * CanRxRunnable and then invoke transitionDone to update lifecycle manager that the component
-     * has completed its transition.
+     * Closes and shuts down all transceivers which will cancel the CAN connections and then
+     * invokes transitionDone to update lifecycle manager that the component has completed its
+     * transition.
      */
     void shutdown() override;
 
     /**
-     * Checks if the given busId is equal to CAN_0. If it is returns a reference else nullptr.
+     * Returns the transceiver of the given busId if it is one of the configured CAN buses,
+     * else nullptr.
      *
      * \param busId BusId.
-     * \return A non-const reference to the CanFlex2Transceiver object.
+     * \return A pointer to the ZephyrCanTransceiver object.
      */
     ::can::ICanTransceiver* getCanTransceiver(uint8_t busId) override;
 
+    /**
+     * Same as getCanTransceiver() for users of the Zephyr specific transceiver API.
+     */
+    ::bios::ZephyrCanTransceiver* getZephyrCanTransceiver(uint8_t busId);
+
+    /**
+     * Shows the messages of the scheduler in the console command "can txsched".
+     */
+    void setTxScheduler(::bios::CanTxScheduler const& scheduler)
+    {
+        _canStatisticsCommand.setTxScheduler(&scheduler);
+    }
+
+    /**
+     * Shows the frames of the monitor in the console command "can rxmon".
+     */
+    void setRxDeadlineMonitor(::bios::CanRxDeadlineMonitor const& monitor)
+    {
+        _canStatisticsCommand.setRxDeadlineMonitor(&monitor);
+    }
+
+    /**
+     * \return number of CAN buses configured in the devicetree
+     */
+    size_t getCanBusCount() const { return _transceivers.size(); }
+
+private:
+    void execute() override;
+
 private:
     ::async::ContextType _context;
-    bios::ZephyrCanTransceiver _transceiver0;
+    ::async::TimeoutType _timeout;
+    ::etl::vector<bios::ZephyrCanTransceiver, MAX_CAN_BUSES> _transceivers;
+
+    ::lifecycle::declare::CanStatisticsCommand<MAX_CAN_BUSES> _canStatisticsCommand;
+    ::console::AsyncCommandWrapper _asyncCommandWrapper_for_canStatisticsCommand;
+#ifdef PLATFORM_SUPPORT_CAN_BENCHMARK
+    ::lifecycle::CanBenchmarkCommand _canBenchmarkCommand;
+    ::console::AsyncCommandWrapper _asyncCommandWrapper_for_canBenchmarkCommand;
+#endif
 };
 
 } // namespace systems
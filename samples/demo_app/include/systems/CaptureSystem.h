@@ -0,0 +1,66 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <capture/CaptureExporter.h>
+#include <console/AsyncCommandWrapper.h>
+#include <lifecycle/AsyncLifecycleComponent.h>
+#include <lifecycle/console/CaptureCommand.h>
+
+#if defined(CONFIG_ARCH_POSIX)
+#include <capture/PcapngWriter.h>
+#include <capture/sink/FileCaptureSink.h>
+#elif defined(PLATFORM_SUPPORT_ETHERNET)
+#include <capture/PcapngWriter.h>
+#include <capture/sink/UdpCaptureSink.h>
+#include <zephyrEthAdapter/udp/ZephyrDatagramSocket.h>
+#else
+#include <capture/CandumpWriter.h>
+#include <capture/sink/UartCaptureSink.h>
+#endif
+
+namespace systems
+{
+/**
+ * Exports the bus capture ring. On native_sim the capture is written to capture.pcapng in the
+ * working directory, on boards with Ethernet it is streamed as pcapng over UDP to the peer
+ * address, otherwise it is streamed in candump format over the UART chosen as
+ * "openbsw,capture-uart".
+ */
+class CaptureSystem
+: public ::lifecycle::AsyncLifecycleComponent
+, private ::async::IRunnable
+{
+public:
+    explicit CaptureSystem(::async::ContextType context);
+    CaptureSystem(CaptureSystem const&)            = delete;
+    CaptureSystem& operator=(CaptureSystem const&) = delete;
+
+    void init() override;
+    void run() override;
+    void shutdown() override;
+
+private:
+    void execute() override;
+
+private:
+    ::async::ContextType const _context;
+    ::async::TimeoutType _timeout;
+
+#if defined(CONFIG_ARCH_POSIX)
+    ::capture::FileCaptureSink _sink;
+    ::capture::PcapngWriter _writer;
+#elif defined(PLATFORM_SUPPORT_ETHERNET)
+    ::udp::ZephyrDatagramSocket _socket;
+    ::capture::UdpCaptureSink _sink;
+    ::capture::PcapngWriter _writer;
+#else
+    ::capture::UartCaptureSink _sink;
+    ::capture::CandumpWriter _writer;
+#endif
+    ::capture::CaptureExporter _exporter;
+    ::lifecycle::CaptureCommand _captureCommand;
+    ::console::AsyncCommandWrapper _asyncCommandWrapper_for_captureCommand;
+};
+
+} // namespace systems
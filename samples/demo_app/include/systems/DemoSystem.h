@@ -6,11 +6,20 @@
 #include <lifecycle/AsyncLifecycleComponent.h>
 #include <lifecycle/console/LifecycleControlCommand.h>
 #ifdef PLATFORM_SUPPORT_CAN
-#include <systems/ICanSystem.h>
+#include <app/DemoCanSignals.h>
+#include <systems/CanSystem.h>
 #include <can/framemgmt/ICANFrameListener.h>
 #include <can/filter/IntervalFilter.h>
+#include <can/monitor/CanRxDeadlineMonitor.h>
+#include <can/scheduler/CanTxScheduler.h>
+#include <can/transceiver/ICanFastPathHandler.h>
 #endif
 #ifdef PLATFORM_SUPPORT_ETHERNET
+#include <lifecycle/console/UdpCommand.h>
+#include <zephyrEthAdapter/tcp/BulkSourceConnection.h>
+#include <zephyrEthAdapter/tcp/FramedEchoConnection.h>
+#include <zephyrEthAdapter/tcp/ZephyrConnectionPool.h>
+#include <zephyrEthAdapter/tcp/ZephyrTxScheduler.h>
 #include <zephyrEthAdapter/udp/UdpEchoServer.h>
 #include <zephyrEthAdapter/tcp/ZephyrServerSocket.h>
 #include <zephyrEthAdapter/tcp/ZephyrSocket.h>
@@ -23,6 +32,9 @@ namespace systems
 class DemoSystem
 : public ::lifecycle::AsyncLifecycleComponent
 , private ::async::IRunnable
+#ifdef PLATFORM_SUPPORT_CAN
+, private ::bios::ICanTxPayloadProvider
+#endif
 {
 public:
     explicit DemoSystem(
@@ -30,7 +42,11 @@ public:
         ::lifecycle::ILifecycleManager& lifecycleManager
 #ifdef PLATFORM_SUPPORT_CAN
         ,
-        ::can::ICanSystem& canSystem
+        ::systems::CanSystem& canSystem
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+        ,
+        ::etl::span<::async::ContextType const> tcpConnectionContexts
 #endif
     );
 
@@ -45,6 +61,13 @@ public:
 
 private:
     void execute() override;
+#ifdef PLATFORM_SUPPORT_CAN
+    void fillPayload(size_t index, ::can::CANFrame& frame) override;
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    /** Sends a counter to the demo multicast group, see udp_multicast_test.py. */
+    void announce();
+#endif
 #if defined(CONFIG_BOARD_S32K148EVB) && defined(CONFIG_ADC)
     int32_t getPotentiometerValue();
 #endif
@@ -66,14 +89,99 @@ private:
         can::IntervalFilter _canFilter;
 
     };
-    ::can::ICanSystem& _canSystem;
+
+    /** Logs the decoded signals of the J1939 message CCVS1. */
+    class VehicleSpeedReceiver : public ::bios::CanMessageListener<::demo::signals::CCVS1>
+    {
+    protected:
+        void messageReceived(uint8_t const payload[]) override;
+    };
+
+    /**
+     * Answers an ISO-TP first frame with a flow control frame directly in the RX interrupt.
+     */
+    class FlowControlFastPathResponder : public ::bios::ICanFastPathHandler
+    {
+    public:
+        bool frameReceivedInIsr(
+            struct can_frame const& frame, ::bios::ZephyrCanTransceiver& transceiver) override;
+    };
+
+    /**
+     * Answers an ISO-TP first frame with a flow control frame from the CAN task, as a
+     * reference for the latency of FlowControlFastPathResponder and for the throughput of
+     * each bus, see can_throughput_test.py.
+     */
+    class FlowControlResponder : public ::can::ICANFrameListener
+    {
+    public:
+        FlowControlResponder();
+
+        void setTransceiver(::can::ICanTransceiver& transceiver) { _transceiver = &transceiver; }
+
+        void frameReceived(::can::CANFrame const& frame) override;
+        ::can::IFilter& getFilter() override { return _filter; }
+
+    private:
+        ::can::IntervalFilter _filter;
+        ::can::ICanTransceiver* _transceiver;
+    };
+
+    /**
+     * Logs frames supervised by the RX deadline monitor which stop and resume arriving.
+     */
+    class RxDeadlineLogger : public ::bios::ICanRxDeadlineListener
+    {
+    public:
+        void rxDeadlineMissed(size_t index, uint32_t id) override;
+        void rxDeadlineRecovered(size_t index, uint32_t id) override;
+    };
+
+    /** number of entries of the cyclic message table in DemoSystem.cpp */
+    static constexpr size_t CAN_TX_MESSAGE_COUNT = 4U;
+    /** number of entries of the RX deadline table in DemoSystem.cpp */
+    static constexpr size_t RX_DEADLINE_COUNT = 3U;
+
+    ::systems::CanSystem& _canSystem;
     CanReceiver _canReceiver;
+    VehicleSpeedReceiver _vehicleSpeedReceiver;
+    ::bios::declare::CanTxScheduler<CAN_TX_MESSAGE_COUNT> _canTxScheduler;
+    FlowControlFastPathResponder _flowControlFastPathResponder;
+    /** one responder per CAN bus */
+    FlowControlResponder _flowControlResponders[::systems::CanSystem::MAX_CAN_BUSES];
+    /** supervises cyclic frames received on CAN_0 */
+    ::bios::declare::CanRxDeadlineMonitor<RX_DEADLINE_COUNT> _rxDeadlineMonitor;
+    RxDeadlineLogger _rxDeadlineLogger;
 #endif
 #ifdef PLATFORM_SUPPORT_ETHERNET
+    /** coalesces the acknowledgements of the TCP loopback server */
+    static constexpr size_t TCP_SEND_BUFFER_SIZE = 512U;
+    /** concurrent connections of the framed echo server, see tcp_connections_test.py */
+#ifdef CONFIG_BOARD_NATIVE_SIM
+    static constexpr size_t FRAMED_ECHO_CONNECTIONS = 16U;
+#else
+    static constexpr size_t FRAMED_ECHO_CONNECTIONS = 4U;
+#endif
+    /** background load next to the framed echo connections, see tcp_priority_test.py */
+    static constexpr size_t BULK_SOURCE_CONNECTIONS = 2U;
+
     ::udp::UdpEchoServer udpEchoServer;
     ::tcp::ZephyrSocket _tcpSocket;
+    uint8_t _tcpSendBuffer[TCP_SEND_BUFFER_SIZE];
     ::tcp::LoopbackTestServer _tcpLoopback;
     ::tcp::ZephyrServerSocket _zephyrServerSocketIpv4;
+    ::tcp::ZephyrTxScheduler _txScheduler;
+    ::tcp::declare::ZephyrConnectionPool<::tcp::FramedEchoConnection, FRAMED_ECHO_CONNECTIONS>
+        _framedEchoPool;
+    ::tcp::ZephyrServerSocket _framedServerSocket;
+    ::tcp::declare::ZephyrConnectionPool<::tcp::BulkSourceConnection, BULK_SOURCE_CONNECTIONS>
+        _bulkSourcePool;
+    ::tcp::ZephyrServerSocket _bulkServerSocket;
+    ::lifecycle::UdpCommand _udpCommand;
+    ::console::AsyncCommandWrapper _asyncCommandWrapper_for_udpCommand;
+    ::udp::ZephyrDatagramSocket _announceSocket;
+    uint32_t _announceCycles;
+    uint32_t _announceCount;
 #endif
 };
 
@@ -93,6 +93,7 @@ private:
     AddressingType _addressing;
     ::docan::DoCanFdFrameSizeMapper<DataLinkLayerType::FrameSizeType> _frameSizeMapper;
     FrameCodecType _classicCodec;
+    FrameCodecType _fdCodec;
     AddressingFilterType _classicAddressingFilter;
 
     ::docan::DoCanParameters _parameters;
@@ -103,7 +104,7 @@ private:
     TransportLayers _transportLayers;
     TickGeneratorRunnableAdapter _tickGenerator;
 
-    FrameCodecType const* _codecs[1];
+    FrameCodecType const* _codecs[2];
 
     static AddressingFilterType::AddressEntryType _addresses[];
 };
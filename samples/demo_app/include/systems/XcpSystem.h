@@ -0,0 +1,88 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <console/AsyncCommandWrapper.h>
+#include <lifecycle/AsyncLifecycleComponent.h>
+#include <lifecycle/console/XcpCommand.h>
+#include <xcp/XcpSlave.h>
+#ifdef PLATFORM_SUPPORT_CAN
+#include <systems/CanSystem.h>
+#include <xcp/XcpOnCan.h>
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+#include <xcp/XcpOnUdp.h>
+#include <zephyrEthAdapter/udp/ZephyrDatagramSocket.h>
+#endif
+
+namespace systems
+{
+/**
+ * XCP slave on CAN_0 and UDP port 5555 measuring demo data. The data is updated every 1 ms
+ * and sampled by the DAQ event channels "1ms" and "10ms", see command xcp.
+ */
+class XcpSystem
+: public ::lifecycle::AsyncLifecycleComponent
+, private ::async::IRunnable
+{
+public:
+    static size_t const EVENT_COUNT  = 2U;
+    static size_t const SIGNAL_COUNT = 64U;
+
+    explicit XcpSystem(
+        ::async::ContextType context
+#ifdef PLATFORM_SUPPORT_CAN
+        ,
+        ::systems::CanSystem& canSystem
+#endif
+    );
+    XcpSystem(XcpSystem const&)            = delete;
+    XcpSystem& operator=(XcpSystem const&) = delete;
+
+    void init() override;
+    void run() override;
+    void shutdown() override;
+
+private:
+    /** address extension 0, read only */
+    struct Measurement
+    {
+        uint32_t _counter;
+        int16_t _triangle;
+        uint16_t _reserved;
+        uint32_t _signals[SIGNAL_COUNT];
+    };
+
+    /** address extension 1, writable */
+    struct Calibration
+    {
+        uint32_t _increment;
+        int16_t _amplitude;
+    };
+
+    static ::xcp::XcpEventChannel const EVENTS[EVENT_COUNT];
+
+    void execute() override;
+
+private:
+    ::async::ContextType const _context;
+    ::async::TimeoutType _timeout;
+    uint32_t _tick;
+    int16_t _slope;
+    Measurement _measurement;
+    Calibration _calibration;
+    ::xcp::XcpMemoryRegion const _regions[2];
+    ::xcp::declare::XcpSlave<EVENT_COUNT, 8U, 64U, 256U> _slave;
+#ifdef PLATFORM_SUPPORT_CAN
+    ::systems::CanSystem& _canSystem;
+    ::xcp::XcpOnCan _canTransport;
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    ::udp::ZephyrDatagramSocket _socket;
+    ::xcp::XcpOnUdp _udpTransport;
+#endif
+    ::lifecycle::XcpCommand _xcpCommand;
+    ::console::AsyncCommandWrapper _asyncCommandWrapper_for_xcpCommand;
+};
+
+} // namespace systems
@@ -10,7 +10,13 @@ enum
     // highest priority task has lowest number
     TASK_SYSADMIN,
     TASK_CAN,
+#ifdef PLATFORM_SUPPORT_CAN
+    TASK_CAN_1,
+#endif
     TASK_DEMO,
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    TASK_ETH,
+#endif
     TASK_UDS,
     TASK_BACKGROUND,
     // --------------------
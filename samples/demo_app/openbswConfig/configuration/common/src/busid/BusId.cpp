@@ -18,6 +18,11 @@ char const* BusIdTraits::getName(uint8_t index)
     {
         BUS_ID_NAME(SELFDIAG);
         BUS_ID_NAME(CAN_0);
+        BUS_ID_NAME(CAN_1);
+        BUS_ID_NAME(CAN_2);
+        BUS_ID_NAME(CAN_3);
+        BUS_ID_NAME(CAN_4);
+        BUS_ID_NAME(CAN_5);
         default: return "INVALID";
     }
 }
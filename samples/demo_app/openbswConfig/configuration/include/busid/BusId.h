@@ -9,7 +9,14 @@
 namespace busid
 {
 static constexpr uint8_t SELFDIAG = 1;
+// CAN bus IDs are contiguous, CAN_<n> is the n-th entry of the CAN bus list in the devicetree
 static constexpr uint8_t CAN_0    = 2;
-static constexpr uint8_t LAST_BUS = CAN_0;
+static constexpr uint8_t CAN_1    = 3;
+static constexpr uint8_t CAN_2    = 4;
+static constexpr uint8_t CAN_3    = 5;
+static constexpr uint8_t CAN_4    = 6;
+static constexpr uint8_t CAN_5    = 7;
+static constexpr uint8_t LAST_CAN = CAN_5;
+static constexpr uint8_t LAST_BUS = LAST_CAN;
 
 } // namespace busid
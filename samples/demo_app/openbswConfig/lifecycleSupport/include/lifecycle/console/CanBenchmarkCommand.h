@@ -0,0 +1,70 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <async/Async.h>
+#include <async/util/Call.h>
+#include <can/canframes/CANFrame.h>
+#include <can/transceiver/ZephyrCanTransceiver.h>
+#include <util/command/GroupCommand.h>
+
+namespace lifecycle
+{
+/**
+ * Console command "canbench" with the micro benchmarks of the CAN stack, only built with
+ * -DOPENBSW_CAN_BENCHMARK=ON.
+ * "canbench tx" compares the time of single writes and a batch write on the first bus. The
+ * transmissions are awaited by rounds scheduled in the context of the command, which logs the
+ * result when both are done.
+ * "canbench dispatch" compares linear and indexed dispatch of received frames to listeners.
+ * "canbench filter" compares the RX acceptance check of standard and extended IDs.
+ * "canbench signal" compares compiled and table-driven decoding of CAN signals.
+ */
+class CanBenchmarkCommand : public ::util::command::GroupCommand
+{
+public:
+    /** number of frames written per benchmark round, fits into the TX batch queue */
+    static size_t const TX_FRAME_COUNT = 16U;
+
+    /**
+     * \param context context the command is executed in
+     */
+    explicit CanBenchmarkCommand(::async::ContextType context);
+
+    /** Sets the bus of "canbench tx". */
+    void setTransceiver(::bios::ZephyrCanTransceiver& transceiver) { _transceiver = &transceiver; }
+
+protected:
+    DECLARE_COMMAND_GROUP_GET_INFO
+    virtual void executeCommand(::util::command::CommandContext& context, uint8_t idx);
+
+private:
+    enum class TxPhase : uint8_t
+    {
+        IDLE,
+        SINGLE,
+        BATCH
+    };
+
+    void startTxBenchmark();
+    /** Checks if the frames of the current phase are sent, then starts the next phase. */
+    void txRoundTask();
+    void scheduleTxRound();
+    bool isTxComplete() const;
+
+    ::async::ContextType const _context;
+    ::bios::ZephyrCanTransceiver* _transceiver;
+    ::can::CANFrame _txFrames[TX_FRAME_COUNT];
+    ::can::ICanTransceiver::ErrorCode _txResults[TX_FRAME_COUNT];
+    ::bios::ZephyrCanTransceiver::Statistics _txBefore;
+    TxPhase _txPhase;
+    uint32_t _txRounds;
+    size_t _singleAccepted;
+    uint32_t _singleCycles;
+    size_t _batchAccepted;
+    uint32_t _batchCycles;
+    ::async::Function _txRoundTask;
+    ::async::TimeoutType _txTimeout;
+};
+
+} // namespace lifecycle
@@ -0,0 +1,26 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <util/format/SharedStringWriter.h>
+
+namespace lifecycle
+{
+// Benchmarks of the "canbench" command, see CanBenchmarkCommand.
+
+/**
+ * Compares linear and indexed dispatch of received frames to 1, 10 and 100 listeners.
+ */
+void runCanDispatchBenchmark(::util::format::SharedStringWriter& writer);
+
+/**
+ * Compares the RX acceptance check of standard IDs with a full extended ID filter.
+ */
+void runCanFilterBenchmark(::util::format::SharedStringWriter& writer);
+
+/**
+ * Compares compiled and table-driven decoding of the signals of a frame.
+ */
+void runCanSignalBenchmark(::util::format::SharedStringWriter& writer);
+
+} // namespace lifecycle
@@ -0,0 +1,77 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <can/gateway/CanRouter.h>
+#include <can/monitor/CanRxDeadlineMonitor.h>
+#include <can/scheduler/CanTxScheduler.h>
+#include <can/transceiver/ZephyrCanTransceiver.h>
+#include <etl/span.h>
+#include <util/command/GroupCommand.h>
+
+namespace lifecycle
+{
+/**
+ * Console command "can stats" printing the traffic and error statistics of the registered
+ * CAN transceivers. Rates are calculated from the snapshots taken in cyclic_1000ms().
+ * "can routes" prints the counters of the gateway routes of the transceivers with a router.
+ * "can fastpath" prints the execution statistics of the RX interrupt fast path handlers.
+ * "can txsched" prints the cyclic messages of the TX scheduler with their jitter.
+ * "can rxmon" prints the state of the frames supervised by the RX deadline monitor.
+ */
+class CanStatisticsCommand : public ::util::command::GroupCommand
+{
+public:
+    struct BusStatistics
+    {
+        ::bios::ZephyrCanTransceiver* _transceiver;
+        ::bios::ZephyrCanTransceiver::Statistics _last;
+        uint32_t _rxFramesPerSecond;
+        uint32_t _txFramesPerSecond;
+        /** bus load in 1/100 % */
+        uint32_t _busLoad;
+    };
+
+    explicit CanStatisticsCommand(::etl::span<BusStatistics> buses);
+
+    /**
+     * Registers a transceiver, the order of registration is the order of the output.
+     * \return false if there is no more room for the transceiver
+     */
+    bool addTransceiver(::bios::ZephyrCanTransceiver& transceiver);
+
+    void setTxScheduler(::bios::CanTxScheduler const* scheduler) { _txScheduler = scheduler; }
+
+    void setRxDeadlineMonitor(::bios::CanRxDeadlineMonitor const* monitor)
+    {
+        _rxDeadlineMonitor = monitor;
+    }
+
+    void cyclic_1000ms();
+
+protected:
+    DECLARE_COMMAND_GROUP_GET_INFO
+    virtual void executeCommand(::util::command::CommandContext& context, uint8_t idx);
+
+private:
+    ::etl::span<BusStatistics> _buses;
+    size_t _busCount;
+    ::bios::CanTxScheduler const* _txScheduler;
+    ::bios::CanRxDeadlineMonitor const* _rxDeadlineMonitor;
+};
+
+namespace declare
+{
+template<size_t N>
+class CanStatisticsCommand : public ::lifecycle::CanStatisticsCommand
+{
+public:
+    CanStatisticsCommand() : ::lifecycle::CanStatisticsCommand(_busStatistics), _busStatistics() {}
+
+private:
+    BusStatistics _busStatistics[N];
+};
+
+} // namespace declare
+
+} // namespace lifecycle
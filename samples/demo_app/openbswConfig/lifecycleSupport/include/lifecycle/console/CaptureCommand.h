@@ -0,0 +1,38 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <capture/CaptureExporter.h>
+#include <util/command/GroupCommand.h>
+
+namespace lifecycle
+{
+/**
+ * Console command "capture" controlling the export of the bus capture ring.
+ */
+class CaptureCommand : public ::util::command::GroupCommand
+{
+public:
+    /**
+     * \param trigger     condition used by "capture arm"
+     * \param preTrigger  number of records exported before the trigger record
+     * \param postTrigger number of records exported after the trigger record
+     */
+    CaptureCommand(
+        ::capture::CaptureExporter& exporter,
+        ::capture::CaptureCondition const& trigger,
+        uint16_t preTrigger,
+        uint16_t postTrigger);
+
+protected:
+    DECLARE_COMMAND_GROUP_GET_INFO
+    virtual void executeCommand(::util::command::CommandContext& context, uint8_t idx);
+
+private:
+    ::capture::CaptureExporter& _exporter;
+    ::capture::CaptureCondition const _trigger;
+    uint16_t const _preTrigger;
+    uint16_t const _postTrigger;
+};
+
+} // namespace lifecycle
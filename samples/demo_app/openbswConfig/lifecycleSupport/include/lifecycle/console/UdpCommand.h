@@ -0,0 +1,40 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <util/command/GroupCommand.h>
+#include <zephyrEthAdapter/tcp/ZephyrTxScheduler.h>
+#include <zephyrEthAdapter/udp/UdpEchoServer.h>
+#include <zephyrEthAdapter/udp/ZephyrDatagramSocket.h>
+
+namespace lifecycle
+{
+/**
+ * Console command "udp" measuring the UDP send path of the echo server and of a benchmark
+ * socket sending to the discard port of the host. It also switches the TX scheduling of the
+ * TCP servers, see tcp_priority_test.py.
+ */
+class UdpCommand : public ::util::command::GroupCommand
+{
+public:
+    UdpCommand(::udp::UdpEchoServer& echoServer, ::tcp::ZephyrTxScheduler& txScheduler);
+
+protected:
+    DECLARE_COMMAND_GROUP_GET_INFO
+    virtual void executeCommand(::util::command::CommandContext& context, uint8_t idx);
+
+private:
+    void printEchoStatistics(::util::command::CommandContext& context);
+    void runSockAddrBenchmark(::util::command::CommandContext& context);
+    void runTxBenchmark(::util::command::CommandContext& context);
+    void printTxSchedulerStatistics(::util::command::CommandContext& context);
+    /** \return cycles spent in sending, the errors are added to errors */
+    uint32_t sendBenchmarkDatagrams(size_t length, bool inPlace, uint32_t& errors);
+
+    ::udp::UdpEchoServer& _echoServer;
+    ::tcp::ZephyrTxScheduler& _txScheduler;
+    ::udp::ZephyrDatagramSocket _benchmarkSocket;
+    uint8_t _benchmarkData[1024U];
+};
+
+} // namespace lifecycle
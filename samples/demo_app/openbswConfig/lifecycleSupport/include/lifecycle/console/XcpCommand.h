@@ -0,0 +1,26 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <util/command/GroupCommand.h>
+#include <xcp/XcpSlave.h>
+
+namespace lifecycle
+{
+/**
+ * Console command "xcp" printing the DAQ throughput and sampling cost of an XCP slave.
+ */
+class XcpCommand : public ::util::command::GroupCommand
+{
+public:
+    explicit XcpCommand(::xcp::XcpSlave& slave);
+
+protected:
+    DECLARE_COMMAND_GROUP_GET_INFO
+    virtual void executeCommand(::util::command::CommandContext& context, uint8_t idx);
+
+private:
+    ::xcp::XcpSlave& _slave;
+};
+
+} // namespace lifecycle
@@ -0,0 +1,180 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/CanBenchmarkCommand.h"
+#include "lifecycle/console/CanBenchmarks.h"
+
+#include <can/CanLogger.h>
+#include <util/format/SharedStringWriter.h>
+
+#include <zephyr/kernel.h>
+
+#include <cstring>
+
+namespace
+{
+uint32_t const TX_BENCHMARK_ID = 0x7F0U;
+/** rounds of 1 ms waiting for the transmission of the frames of a phase */
+uint32_t const TX_BENCHMARK_MAX_ROUNDS = 100U;
+
+enum Id
+{
+    ID_TX,
+    ID_DISPATCH,
+    ID_FILTER,
+    ID_SIGNAL
+};
+
+} // namespace
+
+namespace lifecycle
+{
+size_t const CanBenchmarkCommand::TX_FRAME_COUNT;
+
+DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(CanBenchmarkCommand, "canbench", "CAN benchmark command")
+COMMAND_GROUP_COMMAND(ID_TX, "tx", "compares single and batch writes of 16 frames on the first bus")
+COMMAND_GROUP_COMMAND(ID_DISPATCH, "dispatch", "compares linear and indexed RX frame dispatch")
+COMMAND_GROUP_COMMAND(ID_FILTER, "filter", "compares standard and extended ID acceptance checks")
+COMMAND_GROUP_COMMAND(ID_SIGNAL, "signal", "compares compiled and table-driven signal decoding")
+DEFINE_COMMAND_GROUP_GET_INFO_END
+
+CanBenchmarkCommand::CanBenchmarkCommand(::async::ContextType const context)
+: _context(context)
+, _transceiver(nullptr)
+, _txFrames()
+, _txResults()
+, _txBefore()
+, _txPhase(TxPhase::IDLE)
+, _txRounds(0U)
+, _singleAccepted(0U)
+, _singleCycles(0U)
+, _batchAccepted(0U)
+, _batchCycles(0U)
+, _txRoundTask(::async::Function::CallType::
+                   create<CanBenchmarkCommand, &CanBenchmarkCommand::txRoundTask>(*this))
+, _txTimeout()
+{
+    for (size_t i = 0U; i < TX_FRAME_COUNT; ++i)
+    {
+        _txFrames[i].setId(TX_BENCHMARK_ID);
+        _txFrames[i].setPayloadLength(8U);
+        ::memset(_txFrames[i].getPayload(), static_cast<int>(i), 8U);
+    }
+}
+
+void CanBenchmarkCommand::executeCommand(::util::command::CommandContext& context, uint8_t idx)
+{
+    switch (idx)
+    {
+        case ID_TX:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            if (_transceiver == nullptr)
+            {
+                writer.printf("no CAN bus\n");
+            }
+            else if (_txPhase != TxPhase::IDLE)
+            {
+                writer.printf("already running\n");
+            }
+            else
+            {
+                startTxBenchmark();
+                writer.printf("started, the result is logged\n");
+            }
+            break;
+        }
+        case ID_DISPATCH:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            runCanDispatchBenchmark(writer);
+            break;
+        }
+        case ID_FILTER:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            runCanFilterBenchmark(writer);
+            break;
+        }
+        case ID_SIGNAL:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            runCanSignalBenchmark(writer);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * Only the time spent in write() is measured, the transmission is awaited in between.
+ */
+void CanBenchmarkCommand::startTxBenchmark()
+{
+    _transceiver->getStatistics(_txBefore);
+    _singleAccepted      = 0U;
+    uint32_t const start = k_cycle_get_32();
+    for (auto const& frame : _txFrames)
+    {
+        if (::can::ICanTransceiver::ErrorCode::CAN_ERR_OK == _transceiver->write(frame))
+        {
+            ++_singleAccepted;
+        }
+    }
+    _singleCycles = k_cycle_get_32() - start;
+    _txPhase      = TxPhase::SINGLE;
+    _txRounds     = 0U;
+    scheduleTxRound();
+}
+
+void CanBenchmarkCommand::txRoundTask()
+{
+    ++_txRounds;
+    if ((!isTxComplete()) && (_txRounds < TX_BENCHMARK_MAX_ROUNDS))
+    {
+        scheduleTxRound();
+        return;
+    }
+    if (TxPhase::SINGLE == _txPhase)
+    {
+        _transceiver->getStatistics(_txBefore);
+        uint32_t const start = k_cycle_get_32();
+        _batchAccepted       = _transceiver->write(_txFrames, _txResults);
+        _batchCycles         = k_cycle_get_32() - start;
+        _txPhase             = TxPhase::BATCH;
+        _txRounds            = 0U;
+        scheduleTxRound();
+        return;
+    }
+    _txPhase = TxPhase::IDLE;
+    ::util::logger::Logger::info(
+        ::util::logger::CAN,
+        "%u single writes: %u ns, %u accepted",
+        static_cast<uint32_t>(TX_FRAME_COUNT),
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(_singleCycles)),
+        static_cast<uint32_t>(_singleAccepted));
+    ::util::logger::Logger::info(
+        ::util::logger::CAN,
+        "batch write of %u: %u ns, %u accepted",
+        static_cast<uint32_t>(TX_FRAME_COUNT),
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(_batchCycles)),
+        static_cast<uint32_t>(_batchAccepted));
+}
+
+void CanBenchmarkCommand::scheduleTxRound()
+{
+    ::async::schedule(_context, _txRoundTask, _txTimeout, 1U, ::async::TimeUnit::MILLISECONDS);
+}
+
+bool CanBenchmarkCommand::isTxComplete() const
+{
+    size_t const accepted = (TxPhase::SINGLE == _txPhase) ? _singleAccepted : _batchAccepted;
+    ::bios::ZephyrCanTransceiver::Statistics current;
+    _transceiver->getStatistics(current);
+    return ((current._txFrames - _txBefore._txFrames) + (current._txErrors - _txBefore._txErrors))
+           >= accepted;
+}
+
+} // namespace lifecycle
@@ -0,0 +1,111 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/CanBenchmarks.h"
+
+#include <can/filter/IntervalFilter.h>
+#include <can/framemgmt/ICANFrameListener.h>
+#include <can/transceiver/CanFrameDispatcher.h>
+#include <etl/vector.h>
+#include <util/format/SharedStringWriter.h>
+
+#include <zephyr/kernel.h>
+
+namespace
+{
+size_t const DISPATCH_BENCHMARK_MAX_LISTENERS     = 100U;
+size_t const DISPATCH_BENCHMARK_LISTENER_COUNTS[] = {1U, 10U, DISPATCH_BENCHMARK_MAX_LISTENERS};
+// each listener accepts a range of 16 consecutive standard IDs
+uint32_t const DISPATCH_BENCHMARK_IDS_PER_LISTENER = 16U;
+uint32_t const DISPATCH_BENCHMARK_FRAME_COUNT      = 0x800U;
+
+class BenchmarkListener : public ::can::ICANFrameListener
+{
+public:
+    explicit BenchmarkListener(uint32_t const firstId)
+    : _filter(firstId, firstId + DISPATCH_BENCHMARK_IDS_PER_LISTENER - 1U), _frameCount(0U)
+    {}
+
+    void frameReceived(::can::CANFrame const& /* frame */) override { ++_frameCount; }
+
+    ::can::IFilter& getFilter() override { return _filter; }
+
+    uint32_t getFrameCount() const { return _frameCount; }
+
+private:
+    ::can::IntervalFilter _filter;
+    uint32_t _frameCount;
+};
+
+::etl::vector<BenchmarkListener, DISPATCH_BENCHMARK_MAX_LISTENERS> benchmarkListeners;
+::bios::CanFrameDispatcher benchmarkDispatcher;
+
+/**
+ * Delivers one frame per standard ID to the given number of listeners, once by evaluating
+ * the filters of all listeners per frame as AbstractCANTransceiver::notifyListeners() does
+ * and once with the frame dispatcher.
+ */
+void runDispatchBenchmark(::util::format::SharedStringWriter& writer, size_t const listenerCount)
+{
+    benchmarkListeners.clear();
+    // adding a listener updates the index
+    uint32_t start = k_cycle_get_32();
+    for (size_t i = 0U; i < listenerCount; ++i)
+    {
+        benchmarkListeners.emplace_back(
+            static_cast<uint32_t>(i) * DISPATCH_BENCHMARK_IDS_PER_LISTENER);
+        benchmarkDispatcher.addListener(benchmarkListeners.back(), false);
+    }
+    uint32_t const buildCycles = k_cycle_get_32() - start;
+    ::can::CANFrame frame;
+
+    start = k_cycle_get_32();
+    for (uint32_t id = 0U; id < DISPATCH_BENCHMARK_FRAME_COUNT; ++id)
+    {
+        frame.setId(id);
+        for (auto& listener : benchmarkListeners)
+        {
+            if (listener.getFilter().match(id))
+            {
+                listener.frameReceived(frame);
+            }
+        }
+    }
+    uint32_t const linearCycles = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (uint32_t id = 0U; id < DISPATCH_BENCHMARK_FRAME_COUNT; ++id)
+    {
+        frame.setId(id);
+        (void)benchmarkDispatcher.dispatch(frame);
+    }
+    uint32_t const indexedCycles = k_cycle_get_32() - start;
+
+    uint32_t frameCount = 0U;
+    for (auto& listener : benchmarkListeners)
+    {
+        frameCount += listener.getFrameCount();
+        benchmarkDispatcher.removeListener(listener);
+    }
+
+    writer.printf(
+        "%3u listeners: linear %u ns/frame, indexed %u ns/frame, index build %u us, %u frames\n",
+        static_cast<uint32_t>(listenerCount),
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(linearCycles) / DISPATCH_BENCHMARK_FRAME_COUNT),
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(indexedCycles) / DISPATCH_BENCHMARK_FRAME_COUNT),
+        static_cast<uint32_t>(k_cyc_to_us_floor64(buildCycles)),
+        frameCount);
+}
+
+} // namespace
+
+namespace lifecycle
+{
+void runCanDispatchBenchmark(::util::format::SharedStringWriter& writer)
+{
+    for (size_t const listenerCount : DISPATCH_BENCHMARK_LISTENER_COUNTS)
+    {
+        runDispatchBenchmark(writer, listenerCount);
+    }
+}
+
+} // namespace lifecycle
@@ -0,0 +1,74 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/CanBenchmarks.h"
+
+#include <can/filter/ExtendedIdFilter.h>
+#include <util/format/SharedStringWriter.h>
+
+#include <zephyr/kernel.h>
+
+namespace
+{
+uint32_t const FILTER_BENCHMARK_LOOKUP_COUNT = 0x800U;
+uint32_t const FILTER_BENCHMARK_FIRST_ID     = 0x18DA0000U;
+uint32_t const FILTER_BENCHMARK_RANGE_STEP   = 0x40U;
+
+} // namespace
+
+namespace lifecycle
+{
+/**
+ * Compares the acceptance check of the RX interrupt for standard IDs (bitmap of the listener
+ * filters) with the extended ID filter filled with the maximum number of ranges and masks.
+ */
+void runCanFilterBenchmark(::util::format::SharedStringWriter& writer)
+{
+    static uint8_t bitmap[0x800U / 8U];
+    static ::bios::ExtendedIdFilter extendedIdFilter;
+    extendedIdFilter.clear();
+    for (size_t i = 0U; i < ::bios::ExtendedIdFilter::MAX_RANGES; ++i)
+    {
+        uint32_t const firstId = FILTER_BENCHMARK_FIRST_ID + (i * FILTER_BENCHMARK_RANGE_STEP);
+        (void)extendedIdFilter.addRange(firstId, firstId + (FILTER_BENCHMARK_RANGE_STEP / 2U));
+    }
+    for (size_t i = 0U; i < ::bios::ExtendedIdFilter::MAX_MASKS; ++i)
+    {
+        (void)extendedIdFilter.addPgn(0xFEF0U + i);
+    }
+    for (size_t i = 0U; i < sizeof(bitmap); ++i)
+    {
+        bitmap[i] = static_cast<uint8_t>(i);
+    }
+
+    uint32_t accepted = 0U;
+    uint32_t start    = k_cycle_get_32();
+    for (uint32_t id = 0U; id < FILTER_BENCHMARK_LOOKUP_COUNT; ++id)
+    {
+        // same check as ZephyrCanTransceiver::enqueueRxFrame()
+        if ((bitmap[id / 8U] & (1U << (id % 8U))) != 0U)
+        {
+            ++accepted;
+        }
+    }
+    uint32_t const bitmapCycles = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (uint32_t id = 0U; id < FILTER_BENCHMARK_LOOKUP_COUNT; ++id)
+    {
+        if (extendedIdFilter.match(FILTER_BENCHMARK_FIRST_ID + id))
+        {
+            ++accepted;
+        }
+    }
+    uint32_t const extendedCycles = k_cycle_get_32() - start;
+
+    writer.printf(
+        "standard bitmap %u ns/frame, extended filter (%u ranges, %u masks) %u ns/frame, %u hits\n",
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(bitmapCycles) / FILTER_BENCHMARK_LOOKUP_COUNT),
+        static_cast<uint32_t>(::bios::ExtendedIdFilter::MAX_RANGES),
+        static_cast<uint32_t>(::bios::ExtendedIdFilter::MAX_MASKS),
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(extendedCycles) / FILTER_BENCHMARK_LOOKUP_COUNT),
+        accepted);
+}
+
+} // namespace lifecycle
@@ -0,0 +1,148 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/CanBenchmarks.h"
+
+#include <can/signal/CanSignal.h>
+#include <util/format/SharedStringWriter.h>
+
+#include <zephyr/kernel.h>
+
+namespace
+{
+// signal layout of a typical powertrain frame, mixing byte orders, signs and scalings
+struct SignalBenchmarkMessage : ::bios::CanMessage<0x7F1U, 8U>
+{
+    using Speed = ::bios::
+        CanScaledSignal<::bios::CanSignal<0U, 16U, ::bios::CanByteOrder::INTEL>, 1, 100>;
+    using Torque = ::bios::
+        CanScaledSignal<::bios::CanSignal<16U, 12U, ::bios::CanByteOrder::INTEL, true>, 1, 2>;
+    using Gear        = ::bios::CanSignal<28U, 4U, ::bios::CanByteOrder::INTEL>;
+    using Temperature = ::bios::
+        CanScaledSignal<::bios::CanSignal<39U, 8U, ::bios::CanByteOrder::MOTOROLA>, 1, 1, -40>;
+    using Pressure = ::bios::
+        CanScaledSignal<::bios::CanSignal<47U, 10U, ::bios::CanByteOrder::MOTOROLA>, 1, 10>;
+    using Mode    = ::bios::CanSignal<53U, 3U, ::bios::CanByteOrder::MOTOROLA>;
+    using Counter = ::bios::CanSignal<59U, 4U, ::bios::CanByteOrder::MOTOROLA>;
+};
+
+/**
+ * Runtime description of a signal as interpreted by a generic table-driven decoder.
+ */
+struct GenericSignal
+{
+    uint8_t _startBit;
+    uint8_t _length;
+    bool _motorola;
+    bool _signed;
+    float _factor;
+    float _offset;
+};
+
+// same signals as SignalBenchmarkMessage
+GenericSignal const genericBenchmarkSignals[] = {
+    {0U, 16U, false, false, 0.01F, 0.0F},
+    {16U, 12U, false, true, 0.5F, 0.0F},
+    {28U, 4U, false, false, 1.0F, 0.0F},
+    {39U, 8U, true, false, 1.0F, -40.0F},
+    {47U, 10U, true, false, 0.1F, 0.0F},
+    {53U, 3U, true, false, 1.0F, 0.0F},
+    {59U, 4U, true, false, 1.0F, 0.0F},
+};
+
+float decodeGenericSignal(GenericSignal const& signal, uint8_t const payload[])
+{
+    uint64_t word = 0U;
+    uint32_t shift;
+    if (signal._motorola)
+    {
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+            word = (word << 8U) | payload[i];
+        }
+        uint32_t const msb = ((signal._startBit / 8U) * 8U) + (7U - (signal._startBit % 8U));
+        shift              = 64U - msb - signal._length;
+    }
+    else
+    {
+        for (size_t i = 8U; i > 0U; --i)
+        {
+            word = (word << 8U) | payload[i - 1U];
+        }
+        shift = signal._startBit;
+    }
+    uint64_t const mask
+        = (signal._length < 64U) ? ((static_cast<uint64_t>(1U) << signal._length) - 1U) : ~0ULL;
+    uint64_t const raw = (word >> shift) & mask;
+    int64_t value      = static_cast<int64_t>(raw);
+    if (signal._signed && (((raw >> (signal._length - 1U)) & 1U) != 0U))
+    {
+        value = static_cast<int64_t>(raw | ~mask);
+    }
+    return (static_cast<float>(value) * signal._factor) + signal._offset;
+}
+
+size_t const SIGNAL_BENCHMARK_PAYLOAD_COUNT = 16U;
+uint32_t const SIGNAL_BENCHMARK_FRAME_COUNT = 1024U;
+
+} // namespace
+
+namespace lifecycle
+{
+/**
+ * Compares decoding all signals of a frame with the compile time generated codecs and with
+ * a generic decoder interpreting a signal table at runtime.
+ */
+void runCanSignalBenchmark(::util::format::SharedStringWriter& writer)
+{
+    using Message = SignalBenchmarkMessage;
+    static uint8_t payloads[SIGNAL_BENCHMARK_PAYLOAD_COUNT][Message::LENGTH];
+    uint32_t seed = 0x12345678U;
+    for (auto& payload : payloads)
+    {
+        for (uint8_t& byte : payload)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            byte = static_cast<uint8_t>(seed >> 16U);
+        }
+    }
+
+    // the sums prevent the decoding from being optimized away and must be equal
+    float compiledSum = 0.0F;
+    uint32_t start    = k_cycle_get_32();
+    for (uint32_t i = 0U; i < SIGNAL_BENCHMARK_FRAME_COUNT; ++i)
+    {
+        uint8_t const* const payload = payloads[i % SIGNAL_BENCHMARK_PAYLOAD_COUNT];
+        compiledSum += Message::get<Message::Speed>(payload);
+        compiledSum += Message::get<Message::Torque>(payload);
+        compiledSum += static_cast<float>(Message::get<Message::Gear>(payload));
+        compiledSum += Message::get<Message::Temperature>(payload);
+        compiledSum += Message::get<Message::Pressure>(payload);
+        compiledSum += static_cast<float>(Message::get<Message::Mode>(payload));
+        compiledSum += static_cast<float>(Message::get<Message::Counter>(payload));
+    }
+    uint32_t const compiledCycles = k_cycle_get_32() - start;
+
+    float genericSum = 0.0F;
+    start            = k_cycle_get_32();
+    for (uint32_t i = 0U; i < SIGNAL_BENCHMARK_FRAME_COUNT; ++i)
+    {
+        uint8_t const* const payload = payloads[i % SIGNAL_BENCHMARK_PAYLOAD_COUNT];
+        for (GenericSignal const& signal : genericBenchmarkSignals)
+        {
+            genericSum += decodeGenericSignal(signal, payload);
+        }
+    }
+    uint32_t const genericCycles = k_cycle_get_32() - start;
+
+    // the compiler may contract multiplication and addition differently in both loops
+    float const difference = compiledSum - genericSum;
+    float const tolerance  = ((genericSum < 0.0F) ? -genericSum : genericSum) * 1.0E-5F;
+    writer.printf(
+        "%u signals: compiled %u ns/frame, table-driven %u ns/frame, results %s\n",
+        static_cast<uint32_t>(sizeof(genericBenchmarkSignals) / sizeof(genericBenchmarkSignals[0])),
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(compiledCycles) / SIGNAL_BENCHMARK_FRAME_COUNT),
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(genericCycles) / SIGNAL_BENCHMARK_FRAME_COUNT),
+        ((difference <= tolerance) && (-difference <= tolerance)) ? "equal" : "differ");
+}
+
+} // namespace lifecycle
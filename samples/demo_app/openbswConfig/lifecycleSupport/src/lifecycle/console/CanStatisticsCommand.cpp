@@ -0,0 +1,335 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/CanStatisticsCommand.h"
+
+#include <can/canframes/CanId.h>
+#include <common/busid/BusId.h>
+#include <util/format/SharedStringWriter.h>
+
+#include <zephyr/kernel.h>
+
+namespace
+{
+char const* getStateName(can_state const state)
+{
+    switch (state)
+    {
+        case CAN_STATE_ERROR_ACTIVE:
+        {
+            return "error-active";
+        }
+        case CAN_STATE_ERROR_WARNING:
+        {
+            return "error-warning";
+        }
+        case CAN_STATE_ERROR_PASSIVE:
+        {
+            return "error-passive";
+        }
+        case CAN_STATE_BUS_OFF:
+        {
+            return "bus-off";
+        }
+        default:
+        {
+            return "stopped";
+        }
+    }
+}
+
+void printBus(
+    ::util::format::SharedStringWriter& writer,
+    ::lifecycle::CanStatisticsCommand::BusStatistics const& bus)
+{
+    using Transceiver = ::bios::ZephyrCanTransceiver;
+
+    Transceiver const& transceiver          = *bus._transceiver;
+    Transceiver::Statistics const& counters = bus._last;
+
+    writer.printf(
+        "%s: %u bit/s\n",
+        ::common::busid::BusIdTraits::getName(transceiver.getBusId()),
+        transceiver.getBaudrate());
+    writer.printf(
+        "  rx %u frames/s, tx %u frames/s, load %u.%02u %%\n",
+        bus._rxFramesPerSecond,
+        bus._txFramesPerSecond,
+        bus._busLoad / 100U,
+        bus._busLoad % 100U);
+    writer.printf(
+        "  rx dropped %u, tx overruns %u, tx errors %u, tx queue high-water %u\n",
+        counters._rxDropped,
+        counters._txOverruns,
+        counters._txErrors,
+        counters._txQueueHighWater);
+
+    can_state state;
+    can_bus_err_cnt errCnt;
+    if (transceiver.getErrorCounters(state, errCnt))
+    {
+        writer.printf(
+            "  state %s, tx error counter %u, rx error counter %u\n",
+            getStateName(state),
+            errCnt.tx_err_cnt,
+            errCnt.rx_err_cnt);
+    }
+    else
+    {
+        writer.printf("  state unknown\n");
+    }
+
+    writer.printf("  tx latency us:");
+    for (size_t i = 0U; i < Transceiver::TX_LATENCY_BUCKET_COUNT; ++i)
+    {
+        uint32_t const limit = Transceiver::getTxLatencyBucketLimitUs(i);
+        if (limit == UINT32_MAX)
+        {
+            writer.printf(" >=%u:%u", Transceiver::getTxLatencyBucketLimitUs(i - 1U),
+                counters._txLatency[i]);
+        }
+        else
+        {
+            writer.printf(" <%u:%u", limit, counters._txLatency[i]);
+        }
+    }
+    writer.printf("\n");
+}
+
+void printRoutes(
+    ::util::format::SharedStringWriter& writer, ::bios::ZephyrCanTransceiver const& transceiver)
+{
+    for (auto const& route : transceiver.getRouter()->getRoutes())
+    {
+        char const* const format = route._extended ? "0x%08x" : "0x%03x";
+        writer.printf("%s ", ::common::busid::BusIdTraits::getName(transceiver.getBusId()));
+        writer.printf(format, route._firstId);
+        if (route._lastId != route._firstId)
+        {
+            writer.printf("..");
+            writer.printf(format, route._lastId);
+        }
+        writer.printf(" -> %s", ::common::busid::BusIdTraits::getName(route._destination->getBusId()));
+        if (route._rewriteMask != 0U)
+        {
+            writer.printf(" id 0x%x/0x%x", route._rewriteId, route._rewriteMask);
+        }
+        writer.printf(": forwarded %u, dropped %u\n", route._forwarded, route._dropped);
+    }
+}
+
+void printFastPathHandlers(
+    ::util::format::SharedStringWriter& writer, ::bios::ZephyrCanTransceiver const& transceiver)
+{
+    for (auto const& handler : transceiver.getFastPathHandlers())
+    {
+        writer.printf(
+            handler._extended ? "%s 0x%08x: " : "%s 0x%03x: ",
+            ::common::busid::BusIdTraits::getName(transceiver.getBusId()),
+            handler._id);
+        writer.printf(
+            "calls %u, max %u us, budget %u us, overruns %u, %s\n",
+            handler._calls,
+            static_cast<uint32_t>(k_cyc_to_us_ceil32(handler._maxCycles)),
+            static_cast<uint32_t>(k_cyc_to_us_floor32(handler._budgetCycles)),
+            handler._overruns,
+            handler._enabled ? "enabled" : "disabled");
+    }
+}
+
+void printTxScheduler(
+    ::util::format::SharedStringWriter& writer, ::bios::CanTxScheduler const& scheduler)
+{
+    if (scheduler.getTransceiver() != nullptr)
+    {
+        writer.printf(
+            "%s, tick %u ms\n",
+            ::common::busid::BusIdTraits::getName(scheduler.getTransceiver()->getBusId()),
+            scheduler.getTickMs());
+    }
+    for (size_t i = 0U; i < scheduler.getMessages().size(); ++i)
+    {
+        ::bios::CanTxMessage const& message               = scheduler.getMessages()[i];
+        ::bios::CanTxScheduler::MessageState const& state = scheduler.getState(i);
+        writer.printf(
+            "  0x%x: period %u ms, offset %u ms, sent %u, failed %u",
+            ::can::CanId::rawId(message._id),
+            message._periodMs,
+            state._offsetTicks * scheduler.getTickMs(),
+            state._sent,
+            state._failed);
+        if (state._minDeviationUs <= state._maxDeviationUs)
+        {
+            writer.printf(
+                ", jitter %d us, max delay %d us",
+                state._maxDeviationUs - state._minDeviationUs,
+                state._maxDeviationUs);
+        }
+        writer.printf("\n");
+    }
+}
+
+void printRxDeadlines(
+    ::util::format::SharedStringWriter& writer, ::bios::CanRxDeadlineMonitor const& monitor)
+{
+    if (monitor.getTransceiver() != nullptr)
+    {
+        writer.printf(
+            "%s, sweep %u ms\n",
+            ::common::busid::BusIdTraits::getName(monitor.getTransceiver()->getBusId()),
+            monitor.getSweepMs());
+    }
+    for (size_t i = 0U; i < monitor.getSize(); ++i)
+    {
+        ::bios::CanRxDeadlineMonitor::Supervision const& supervision = monitor.getSupervision(i);
+        writer.printf(
+            "  0x%x: timeout %u ms, misses %u, ",
+            ::can::CanId::rawId(monitor.getId(i)),
+            supervision._timeoutMs,
+            supervision._misses);
+        if (supervision._missed)
+        {
+            writer.printf("missing\n");
+        }
+        else
+        {
+            writer.printf("last received %u ms ago\n", monitor.getAgeMs(i));
+        }
+    }
+}
+
+enum Id
+{
+    ID_STATS,
+    ID_ROUTES,
+    ID_FAST_PATH,
+    ID_TX_SCHEDULER,
+    ID_RX_DEADLINES
+};
+
+} // namespace
+
+namespace lifecycle
+{
+DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(CanStatisticsCommand, "can", "CAN bus command")
+COMMAND_GROUP_COMMAND(ID_STATS, "stats", "prints CAN bus statistics")
+COMMAND_GROUP_COMMAND(ID_ROUTES, "routes", "prints CAN gateway routes")
+COMMAND_GROUP_COMMAND(ID_FAST_PATH, "fastpath", "prints RX interrupt fast path handlers")
+COMMAND_GROUP_COMMAND(ID_TX_SCHEDULER, "txsched", "prints cyclic TX messages and their jitter")
+COMMAND_GROUP_COMMAND(ID_RX_DEADLINES, "rxmon", "prints supervised RX frames and their timeouts")
+DEFINE_COMMAND_GROUP_GET_INFO_END
+
+CanStatisticsCommand::CanStatisticsCommand(::etl::span<BusStatistics> const buses)
+: _buses(buses)
+, _busCount(0U)
+, _txScheduler(nullptr)
+, _rxDeadlineMonitor(nullptr)
+{}
+
+bool CanStatisticsCommand::addTransceiver(::bios::ZephyrCanTransceiver& transceiver)
+{
+    if (_busCount >= _buses.size())
+    {
+        return false;
+    }
+    BusStatistics& bus     = _buses[_busCount];
+    bus._transceiver       = &transceiver;
+    bus._rxFramesPerSecond = 0U;
+    bus._txFramesPerSecond = 0U;
+    bus._busLoad           = 0U;
+    transceiver.getStatistics(bus._last);
+    ++_busCount;
+    return true;
+}
+
+void CanStatisticsCommand::cyclic_1000ms()
+{
+    for (size_t i = 0U; i < _busCount; ++i)
+    {
+        BusStatistics& bus = _buses[i];
+        ::bios::ZephyrCanTransceiver::Statistics current;
+        bus._transceiver->getStatistics(current);
+
+        uint32_t const bitTimes = (current._rxBitTimes - bus._last._rxBitTimes)
+                                  + (current._txBitTimes - bus._last._txBitTimes);
+        bus._rxFramesPerSecond  = current._rxFrames - bus._last._rxFrames;
+        bus._txFramesPerSecond  = current._txFrames - bus._last._txFrames;
+        bus._busLoad            = static_cast<uint32_t>(
+            (static_cast<uint64_t>(bitTimes) * 10000U) / bus._transceiver->getBaudrate());
+        bus._last               = current;
+    }
+}
+
+void CanStatisticsCommand::executeCommand(::util::command::CommandContext& context, uint8_t idx)
+{
+    switch (idx)
+    {
+        case ID_STATS:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            for (size_t i = 0U; i < _busCount; ++i)
+            {
+                printBus(writer, _buses[i]);
+            }
+            break;
+        }
+        case ID_ROUTES:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            bool routed = false;
+            for (size_t i = 0U; i < _busCount; ++i)
+            {
+                if (_buses[i]._transceiver->getRouter() != nullptr)
+                {
+                    printRoutes(writer, *_buses[i]._transceiver);
+                    routed = true;
+                }
+            }
+            if (!routed)
+            {
+                writer.printf("no gateway\n");
+            }
+            break;
+        }
+        case ID_FAST_PATH:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            for (size_t i = 0U; i < _busCount; ++i)
+            {
+                printFastPathHandlers(writer, *_buses[i]._transceiver);
+            }
+            break;
+        }
+        case ID_TX_SCHEDULER:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            if (_txScheduler == nullptr)
+            {
+                writer.printf("no TX scheduler\n");
+            }
+            else
+            {
+                printTxScheduler(writer, *_txScheduler);
+            }
+            break;
+        }
+        case ID_RX_DEADLINES:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            if (_rxDeadlineMonitor == nullptr)
+            {
+                writer.printf("no RX deadline monitor\n");
+            }
+            else
+            {
+                printRxDeadlines(writer, *_rxDeadlineMonitor);
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+} // namespace lifecycle
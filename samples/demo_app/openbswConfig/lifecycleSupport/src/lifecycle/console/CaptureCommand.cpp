@@ -0,0 +1,95 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/CaptureCommand.h"
+
+#include <util/format/SharedStringWriter.h>
+
+namespace
+{
+char const* getStateName(::capture::CaptureExporter::State const state)
+{
+    switch (state)
+    {
+        case ::capture::CaptureExporter::State::ARMED:
+        {
+            return "armed";
+        }
+        case ::capture::CaptureExporter::State::RUNNING:
+        {
+            return "running";
+        }
+        case ::capture::CaptureExporter::State::TRIGGERED:
+        {
+            return "triggered";
+        }
+        default:
+        {
+            return "stopped";
+        }
+    }
+}
+
+enum Id
+{
+    ID_START,
+    ID_ARM,
+    ID_STOP,
+    ID_STATUS
+};
+
+} // namespace
+
+namespace lifecycle
+{
+DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(CaptureCommand, "capture", "bus capture command")
+COMMAND_GROUP_COMMAND(ID_START, "start", "starts exporting all captured frames")
+COMMAND_GROUP_COMMAND(ID_ARM, "arm", "exports the frames around the next trigger frame")
+COMMAND_GROUP_COMMAND(ID_STOP, "stop", "stops the capture")
+COMMAND_GROUP_COMMAND(ID_STATUS, "status", "prints the capture state")
+DEFINE_COMMAND_GROUP_GET_INFO_END
+
+CaptureCommand::CaptureCommand(
+    ::capture::CaptureExporter& exporter,
+    ::capture::CaptureCondition const& trigger,
+    uint16_t const preTrigger,
+    uint16_t const postTrigger)
+: _exporter(exporter), _trigger(trigger), _preTrigger(preTrigger), _postTrigger(postTrigger)
+{}
+
+void CaptureCommand::executeCommand(::util::command::CommandContext& context, uint8_t idx)
+{
+    switch (idx)
+    {
+        case ID_START:
+        {
+            _exporter.start();
+            break;
+        }
+        case ID_ARM:
+        {
+            _exporter.arm(_trigger, _preTrigger, _postTrigger);
+            break;
+        }
+        case ID_STOP:
+        {
+            _exporter.stop();
+            break;
+        }
+        case ID_STATUS:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            writer.printf(
+                "capture %s, exported %d, lost %d\n",
+                getStateName(_exporter.getState()),
+                _exporter.getExportedCount(),
+                _exporter.getLostCount());
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+} // namespace lifecycle
@@ -0,0 +1,308 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/UdpCommand.h"
+
+#include <udp/DatagramPacket.h>
+#include <util/format/SharedStringWriter.h>
+#include <zephyrEthAdapter/utils/EthHelper.h>
+
+#include <zephyr/kernel.h>
+
+#include <cstring>
+
+namespace
+{
+enum Id
+{
+    ID_ECHO,
+    ID_RESET,
+    ID_BATCH,
+    ID_SOCKADDR_BENCH,
+    ID_TX_BENCH,
+    ID_TX_SCHED,
+    ID_TX_STAT
+};
+
+size_t const BENCHMARK_CONVERSIONS = 10000U;
+size_t const BENCHMARK_DATAGRAMS   = 1000U;
+/** datagrams sent back to back, then the TX thread gets time to drain the packet pool */
+size_t const BENCHMARK_BURST       = 8U;
+uint16_t const BENCHMARK_PORT      = 4445U;
+uint16_t const DISCARD_PORT        = 9U;
+size_t const BENCHMARK_LENGTHS[]   = {64U, 1024U};
+
+char const* const TX_SCHEDULER_MODES[] = {"fifo", "strict", "weighted"};
+
+/**
+ * Previous conversion through the text representation, kept as reference for the benchmark.
+ */
+void toSockAddrFromText(::ip::IPAddress const& ip, uint16_t const port, sockaddr_storage& addr)
+{
+    memset(&addr, 0, sizeof(addr));
+    sockaddr_in& ipv4Addr = reinterpret_cast<sockaddr_in&>(addr);
+    ipv4Addr.sin_family   = AF_INET;
+    ipv4Addr.sin_port     = htons(port);
+    char strBuffer[INET_ADDRSTRLEN];
+    (void)zsock_inet_pton(AF_INET, ::ip::to_str(ip, strBuffer).data(), &ipv4Addr.sin_addr);
+}
+
+uint32_t toNsPerConversion(uint32_t const cycles)
+{
+    return static_cast<uint32_t>(k_cyc_to_ns_floor64(cycles) / BENCHMARK_CONVERSIONS);
+}
+
+} // namespace
+
+namespace lifecycle
+{
+DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(UdpCommand, "udp", "UDP command")
+COMMAND_GROUP_COMMAND(ID_ECHO, "echo", "prints the receive and send path of the UDP echo server")
+COMMAND_GROUP_COMMAND(ID_RESET, "reset", "resets the echo server statistics")
+COMMAND_GROUP_COMMAND(ID_BATCH, "batch", "toggles batched receive and send of the echo server")
+COMMAND_GROUP_COMMAND(
+    ID_SOCKADDR_BENCH, "sockaddrbench", "compares text, binary and cached sockaddr conversion")
+COMMAND_GROUP_COMMAND(ID_TX_BENCH, "txbench", "compares copying and in-place UDP transmission")
+COMMAND_GROUP_COMMAND(
+    ID_TX_SCHED, "txsched", "cycles the TCP TX scheduling through fifo, strict and weighted")
+COMMAND_GROUP_COMMAND(ID_TX_STAT, "txstat", "prints and resets the bytes granted per TCP class")
+DEFINE_COMMAND_GROUP_GET_INFO_END
+
+UdpCommand::UdpCommand(::udp::UdpEchoServer& echoServer, ::tcp::ZephyrTxScheduler& txScheduler)
+: _echoServer(echoServer), _txScheduler(txScheduler), _benchmarkSocket(), _benchmarkData()
+{}
+
+void UdpCommand::executeCommand(::util::command::CommandContext& context, uint8_t idx)
+{
+    switch (idx)
+    {
+        case ID_ECHO:
+        {
+            printEchoStatistics(context);
+            break;
+        }
+        case ID_RESET:
+        {
+            _echoServer.resetStatistics();
+            break;
+        }
+        case ID_BATCH:
+        {
+            _echoServer.setBatched(!_echoServer.isBatched());
+            ::util::format::SharedStringWriter writer(context);
+            writer.printf("echo server %s\n", _echoServer.isBatched() ? "batched" : "unbatched");
+            break;
+        }
+        case ID_SOCKADDR_BENCH:
+        {
+            runSockAddrBenchmark(context);
+            break;
+        }
+        case ID_TX_BENCH:
+        {
+            runTxBenchmark(context);
+            break;
+        }
+        case ID_TX_SCHED:
+        {
+            size_t const mode = (static_cast<size_t>(_txScheduler.getMode()) + 1U)
+                                % (sizeof(TX_SCHEDULER_MODES) / sizeof(TX_SCHEDULER_MODES[0]));
+            _txScheduler.setMode(static_cast<::tcp::ZephyrTxScheduler::Mode>(mode));
+            _txScheduler.resetStatistics();
+            ::util::format::SharedStringWriter writer(context);
+            writer.printf("TCP TX scheduling %s\n", TX_SCHEDULER_MODES[mode]);
+            break;
+        }
+        case ID_TX_STAT:
+        {
+            printTxSchedulerStatistics(context);
+            _txScheduler.resetStatistics();
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+void UdpCommand::printEchoStatistics(::util::command::CommandContext& context)
+{
+    ::udp::UdpEchoServer::Statistics const& statistics = _echoServer.getStatistics();
+    uint32_t nsPerSend = 0U;
+    if (statistics._echoes > 0U)
+    {
+        nsPerSend = static_cast<uint32_t>(
+            k_cyc_to_ns_floor64(statistics._sendCycles) / statistics._echoes);
+    }
+    ::util::format::SharedStringWriter writer(context);
+    writer.printf(
+        "echoes %d (%d gathered), send errors %d, send %d ns average, %d ns max\n",
+        statistics._echoes,
+        statistics._gathered,
+        statistics._sendErrors,
+        nsPerSend,
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(statistics._maxSendCycles)));
+    ::zethutils::DeliveryStatistics const& delivery = _echoServer.getDeliveryStatistics();
+    uint32_t nsPerDelivery                          = 0U;
+    if (delivery._deliveries > 0U)
+    {
+        nsPerDelivery = static_cast<uint32_t>(
+            k_cyc_to_ns_floor64(delivery._delayCycles) / delivery._deliveries);
+    }
+    writer.printf(
+        "queued %d, max depth %d, drops %d, delay %d ns average, %d ns max\n",
+        delivery._delivered,
+        delivery._maxDepth,
+        delivery._drops,
+        nsPerDelivery,
+        static_cast<uint32_t>(k_cyc_to_ns_floor64(delivery._maxDelayCycles)));
+    if (_echoServer.isBatched())
+    {
+        writer.printf(
+            "batches %d, batch drops %d\n",
+            statistics._batches,
+            _echoServer.getBatchDropCount());
+    }
+}
+
+void UdpCommand::printTxSchedulerStatistics(::util::command::CommandContext& context)
+{
+    ::util::format::SharedStringWriter writer(context);
+    writer.printf(
+        "TCP TX scheduling %s, saturated periods %d\n",
+        TX_SCHEDULER_MODES[static_cast<size_t>(_txScheduler.getMode())],
+        _txScheduler.getSaturatedCount());
+    for (size_t priority = 0U; priority < ::tcp::ZephyrTxScheduler::CLASS_COUNT; ++priority)
+    {
+        uint32_t const granted = _txScheduler.getGrantedLength(static_cast<uint8_t>(priority));
+        if (granted > 0U)
+        {
+            writer.printf("priority %d: %d bytes\n", static_cast<int>(priority), granted);
+        }
+    }
+}
+
+void UdpCommand::runSockAddrBenchmark(::util::command::CommandContext& context)
+{
+    ::ip::IPAddress const ip = ::ip::make_ip4(192U, 0U, 2U, 2U);
+    uint16_t const port      = 4444U;
+    sockaddr_storage addr;
+    // prevents the conversions from being optimized away
+    uint32_t volatile sink = 0U;
+
+    uint32_t start = k_cycle_get_32();
+    for (size_t i = 0U; i < BENCHMARK_CONVERSIONS; ++i)
+    {
+        toSockAddrFromText(ip, port, addr);
+        sink = sink + reinterpret_cast<sockaddr_in const&>(addr).sin_addr.s_addr;
+    }
+    uint32_t const textCycles = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (size_t i = 0U; i < BENCHMARK_CONVERSIONS; ++i)
+    {
+        (void)zethutils::toSockAddr(&ip, port, addr);
+        sink = sink + reinterpret_cast<sockaddr_in const&>(addr).sin_addr.s_addr;
+    }
+    uint32_t const binaryCycles = k_cycle_get_32() - start;
+
+    // what ZephyrDatagramSocket::send(DatagramPacket) does for the cached destination
+    ::ip::IPAddress const cachedIp     = ip;
+    uint16_t volatile const cachedPort = port;
+    start                              = k_cycle_get_32();
+    for (size_t i = 0U; i < BENCHMARK_CONVERSIONS; ++i)
+    {
+        if ((cachedPort == port) && (cachedIp == ip))
+        {
+            sink = sink + 1U;
+        }
+    }
+    uint32_t const cachedCycles = k_cycle_get_32() - start;
+
+    ::util::format::SharedStringWriter writer(context);
+    writer.printf(
+        "%d conversions: text %d ns, binary %d ns, cached %d ns\n",
+        BENCHMARK_CONVERSIONS,
+        toNsPerConversion(textCycles),
+        toNsPerConversion(binaryCycles),
+        toNsPerConversion(cachedCycles));
+}
+
+void UdpCommand::runTxBenchmark(::util::command::CommandContext& context)
+{
+    ::util::format::SharedStringWriter writer(context);
+    if (!_benchmarkSocket.isBound())
+    {
+        ::ip::IPAddress const any = ::ip::make_ip4(0U, 0U, 0U, 0U);
+        if (_benchmarkSocket.bind(&any, BENCHMARK_PORT)
+            != ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
+        {
+            writer.printf("bind failed\n");
+            return;
+        }
+        _benchmarkSocket.setCaptured(false);
+    }
+    for (size_t const length : BENCHMARK_LENGTHS)
+    {
+        for (bool const inPlace : {false, true})
+        {
+            uint32_t errors        = 0U;
+            uint32_t const cycles  = sendBenchmarkDatagrams(length, inPlace, errors);
+            uint64_t const ns      = k_cyc_to_ns_floor64(cycles);
+            uint64_t const bytes   = static_cast<uint64_t>(length) * BENCHMARK_DATAGRAMS;
+            uint32_t const usPerMb = static_cast<uint32_t>((ns * 1000U) / bytes);
+            writer.printf(
+                "%-8s %4d bytes: %d ns per datagram, %d us CPU per MB, %d errors\n",
+                inPlace ? "in place" : "copy",
+                static_cast<uint32_t>(length),
+                static_cast<uint32_t>(ns / BENCHMARK_DATAGRAMS),
+                usPerMb,
+                errors);
+        }
+    }
+}
+
+uint32_t
+UdpCommand::sendBenchmarkDatagrams(size_t const length, bool const inPlace, uint32_t& errors)
+{
+    ::ip::IPAddress const ip = ::ip::make_ip4(192U, 0U, 2U, 2U);
+    uint32_t cycles          = 0U;
+    for (size_t i = 0U; i < BENCHMARK_DATAGRAMS; ++i)
+    {
+        if ((i % BENCHMARK_BURST) == 0U)
+        {
+            k_sleep(K_MSEC(1));
+        }
+        // memset() stands in for serializing the payload
+        uint8_t const value  = static_cast<uint8_t>(i);
+        uint32_t const start = k_cycle_get_32();
+        ::udp::AbstractDatagramSocket::ErrorCode result;
+        if (inPlace)
+        {
+            ::udp::TransmitDatagram datagram;
+            result = _benchmarkSocket.allocate(ip, DISCARD_PORT, length, datagram);
+            if (result == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
+            {
+                for (::udp::TransmitDatagram::Fragment const& fragment : datagram.getFragments())
+                {
+                    (void)memset(fragment.data(), value, fragment.size());
+                }
+                result = _benchmarkSocket.commit(datagram, length);
+            }
+        }
+        else
+        {
+            (void)memset(_benchmarkData, value, length);
+            result = _benchmarkSocket.send(::udp::DatagramPacket(
+                _benchmarkData, static_cast<uint16_t>(length), ip, DISCARD_PORT));
+        }
+        cycles += k_cycle_get_32() - start;
+        if (result != ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
+        {
+            ++errors;
+        }
+    }
+    return cycles;
+}
+
+} // namespace lifecycle
@@ -0,0 +1,86 @@
+// Copyright 2025 Accenture.
+
+#include "lifecycle/console/XcpCommand.h"
+
+#include <util/format/SharedStringWriter.h>
+
+#include <zephyr/kernel.h>
+
+namespace
+{
+enum Id
+{
+    ID_STATS,
+    ID_RESET
+};
+
+} // namespace
+
+namespace lifecycle
+{
+DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(XcpCommand, "xcp", "XCP slave command")
+COMMAND_GROUP_COMMAND(ID_STATS, "stats", "prints DAQ throughput and cost per sampled signal")
+COMMAND_GROUP_COMMAND(ID_RESET, "reset", "resets the DAQ statistics")
+DEFINE_COMMAND_GROUP_GET_INFO_END
+
+XcpCommand::XcpCommand(::xcp::XcpSlave& slave) : _slave(slave) {}
+
+void XcpCommand::executeCommand(::util::command::CommandContext& context, uint8_t idx)
+{
+    switch (idx)
+    {
+        case ID_STATS:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            uint32_t const ageMs = _slave.getStatisticsAgeMs();
+            writer.printf(
+                "%s, %d DAQ lists running, %d commands dropped, statistics of %d ms\n",
+                _slave.isConnected() ? "connected" : "disconnected",
+                _slave.getRunningDaqListCount(),
+                _slave.getDroppedCommandCount(),
+                ageMs);
+            for (size_t i = 0U; i < _slave.getEventCount(); ++i)
+            {
+                ::xcp::XcpEventChannel const& event           = _slave.getEvent(i);
+                ::xcp::XcpSlave::EventStatistics const& stats = _slave.getStatistics(i);
+
+                uint32_t nsPerSignal = 0U;
+                uint32_t bytesPerS   = 0U;
+                if (stats._entries > 0U)
+                {
+                    nsPerSignal = static_cast<uint32_t>(
+                        k_cyc_to_ns_floor64(stats._cycles) / stats._entries);
+                }
+                if (ageMs > 0U)
+                {
+                    bytesPerS = static_cast<uint32_t>(
+                        (static_cast<uint64_t>(stats._bytes) * 1000U) / ageMs);
+                }
+                writer.printf(
+                    "event %d %-5s samples %d dtos %d signals %d overruns %d: %d bytes/s, "
+                    "%d ns/signal, max %d us\n",
+                    i,
+                    event._name,
+                    stats._samples,
+                    stats._odts,
+                    stats._entries,
+                    stats._overruns,
+                    bytesPerS,
+                    nsPerSignal,
+                    static_cast<uint32_t>(k_cyc_to_ns_floor64(stats._maxCycles) / 1000U));
+            }
+            break;
+        }
+        case ID_RESET:
+        {
+            _slave.resetStatistics();
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+} // namespace lifecycle
@@ -22,6 +22,12 @@
 #include "systems/UdsSystem.h"
 #include "systems/DoCanSystem.h"
 #endif
+#ifdef PLATFORM_SUPPORT_CAPTURE
+#include "systems/CaptureSystem.h"
+#endif
+#ifdef PLATFORM_SUPPORT_XCP
+#include "systems/XcpSystem.h"
+#endif
 
 using ::util::logger::LIFECYCLE;
 using ::util::logger::DEMO;
@@ -58,12 +64,62 @@ LifecycleManager lifecycleManager{
 ::systems::SysAdminSystem sysAdminSystem{TASK_SYSADMIN, lifecycleManager};
 
 #ifdef PLATFORM_SUPPORT_CAN
-::systems::CanSystem canSystem{TASK_CAN};
+// extended frames delivered to the listeners on CAN_0: J1939 PGN 0xFEF1 (cruise control/vehicle
+// speed) and diagnostic requests with normal fixed addressing to target address 0xF1
+uint32_t const can0AcceptedPgns[] = {0xFEF1U};
+::systems::CanSystem::ExtendedIdRange const can0AcceptedExtendedIds[]
+    = {{0x18DAF100U, 0x18DAF1FFU}};
+
+#ifdef PLATFORM_SUPPORT_CAN_GATEWAY
+// routes of frames received on CAN_0, see ::bios::CanRouter::addRoute()
+::systems::CanSystem::Route const can0Routes[] = {
+    {0x200U, 0x20FU, false, ::busid::CAN_1, 0U, 0U},
+    {0x300U, 0x300U, false, ::busid::CAN_1, 0x301U, CAN_STD_ID_MASK},
+    {0x380U, 0x38FU, false, ::busid::CAN_1, 0x480U, 0x7F0U},
+    {0x18FEF100U, 0x18FEF10FU, true, ::busid::CAN_1, 0U, 0U},
+};
+::bios::CanRouter can0Router;
+#endif
+
+// the second CAN bus of the devicetree bus list gets its own task, all others run in TASK_CAN
+::systems::CanSystem::BusConfig const canBusConfigs[] = {
+    {TASK_CAN,
+     can0AcceptedPgns,
+     can0AcceptedExtendedIds,
+#ifdef PLATFORM_SUPPORT_CAN_GATEWAY
+     &can0Router,
+     can0Routes},
+#else
+     nullptr,
+     {}},
+#endif
+    {TASK_CAN_1, {}, {}, nullptr, {}},
+};
+::systems::CanSystem canSystem{TASK_CAN, canBusConfigs};
 ::transport::TransportSystem transportSystem{TASK_UDS};
 ::docan::DoCanSystem doCanSystem{transportSystem, canSystem, TASK_CAN};
 ::uds::UdsSystem udsSystem{lifecycleManager, transportSystem, TASK_UDS, LOGICAL_ADDRESS};
 #endif
 
+#ifdef PLATFORM_SUPPORT_CAPTURE
+::systems::CaptureSystem captureSystem{TASK_BACKGROUND};
+#endif
+
+#ifdef PLATFORM_SUPPORT_XCP
+::systems::XcpSystem xcpSystem{
+    TASK_DEMO
+#ifdef PLATFORM_SUPPORT_CAN
+    ,
+    canSystem
+#endif
+};
+#endif
+
+#ifdef PLATFORM_SUPPORT_ETHERNET
+// the connections of the framed TCP echo server are spread over both tasks
+::async::ContextType const tcpConnectionContexts[] = {TASK_DEMO, TASK_ETH};
+#endif
+
 ::systems::DemoSystem demoSystem{
     TASK_DEMO,
     lifecycleManager
@@ -71,6 +127,10 @@ LifecycleManager lifecycleManager{
     ,
     canSystem
 #endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    ,
+    tcpConnectionContexts
+#endif
 };
 
 K_THREAD_STACK_DEFINE(sysadminStack, 1024);
@@ -81,10 +141,22 @@ K_THREAD_STACK_DEFINE(demoStack, 4 * 1024);
 using DemoTask = AsyncAdapter::Task<TASK_DEMO, K_THREAD_STACK_SIZEOF(demoStack)>;
 DemoTask demoTask{"demo", demoStack};
 
+#ifdef PLATFORM_SUPPORT_ETHERNET
+K_THREAD_STACK_DEFINE(ethStack, 2 * 1024);
+using EthTask = AsyncAdapter::Task<TASK_ETH, K_THREAD_STACK_SIZEOF(ethStack)>;
+EthTask ethTask{"eth", ethStack};
+#endif
+
 K_THREAD_STACK_DEFINE(canStack, 1024);
 using CanTask = AsyncAdapter::Task<TASK_CAN, K_THREAD_STACK_SIZEOF(canStack)>;
 CanTask canTask{"can", canStack};
 
+#ifdef PLATFORM_SUPPORT_CAN
+K_THREAD_STACK_DEFINE(can1Stack, 1024);
+using Can1Task = AsyncAdapter::Task<TASK_CAN_1, K_THREAD_STACK_SIZEOF(can1Stack)>;
+Can1Task can1Task{"can1", can1Stack};
+#endif
+
 K_THREAD_STACK_DEFINE(udsStack, 2 * 1024);
 using UdsTask = AsyncAdapter::Task<TASK_UDS, K_THREAD_STACK_SIZEOF(udsStack)>;
 UdsTask udsTask{"uds", udsStack};
@@ -169,11 +241,17 @@ int main(void)
     AsyncAdapter::init();
 
     lifecycleManager.addComponent("runtime", runtimeSystem, 1U);
+#ifdef PLATFORM_SUPPORT_CAPTURE
+    lifecycleManager.addComponent("capture", captureSystem, 1U);
+#endif
 #ifdef PLATFORM_SUPPORT_CAN
     lifecycleManager.addComponent("can", canSystem, 2U);
     lifecycleManager.addComponent("transport", transportSystem, 4U);
     lifecycleManager.addComponent("docan", doCanSystem, 5U);
     lifecycleManager.addComponent("uds", udsSystem, 6U);
+#endif
+#ifdef PLATFORM_SUPPORT_XCP
+    lifecycleManager.addComponent("xcp", xcpSystem, 7U);
 #endif
     lifecycleManager.addComponent("sysadmin", sysAdminSystem, 7U);
     lifecycleManager.addComponent("demo", demoSystem, 8U);
@@ -8,51 +8,186 @@
 #include "lifecycle/ILifecycleManager.h"
 #include "util/command/IParentCommand.h"
 
+#include <etl/algorithm.h>
+
 #include "zephyr/device.h"
 
-#define CAN_INTERFACE DEVICE_DT_GET(DT_CHOSEN(zephyr_canbus))
-#define CAN_BITRATE (DT_PROP_OR(DT_CHOSEN(zephyr_canbus), bitrate, \
-            DT_PROP_OR(DT_CHOSEN(zephyr_canbus), bus_speed, \
+#define CAN_BITRATE(node) (DT_PROP_OR(node, bitrate, \
+            DT_PROP_OR(node, bus_speed, \
             CONFIG_CAN_DEFAULT_BITRATE)))
+#define CAN_BITRATE_DATA(node) (DT_PROP_OR(node, bitrate_data, \
+            DT_PROP_OR(node, bus_speed_data, 0)))
+
+#ifdef CONFIG_CAN_FD_MODE
+#define CAN_FRAME_FORMAT ::bios::ZephyrCanTransceiver::FrameFormat::FD
+#else
+#define CAN_FRAME_FORMAT ::bios::ZephyrCanTransceiver::FrameFormat::CLASSIC
+#endif
+
+// The CAN buses are listed in the property "can-buses" of the "zephyr,user" node, e.g.
+//     zephyr,user { can-buses = <&can0 &can1>; };
+// The n-th entry is mapped to ::busid::CAN_0 + n. Without this property the single bus
+// "zephyr,canbus" is used.
+#define CAN_BUS_LIST_NODE DT_PATH(zephyr_user)
+
+#define CAN_BUS_CONFIG(node)                                                  \
+    {DEVICE_DT_GET(node), CAN_BITRATE(node), CAN_BITRATE_DATA(node)},
+
+#define CAN_BUS_CONFIG_BY_IDX(node, prop, idx)                                \
+    CAN_BUS_CONFIG(DT_PHANDLE_BY_IDX(node, prop, idx))
+
+namespace
+{
+struct CanBusConfig
+{
+    const struct device* _device;
+    uint32_t _bitrate;
+    uint32_t _dataBitrate;
+};
+
+CanBusConfig const canBusConfigs[] = {
+#if DT_NODE_HAS_PROP(CAN_BUS_LIST_NODE, can_buses)
+    DT_FOREACH_PROP_ELEM(CAN_BUS_LIST_NODE, can_buses, CAN_BUS_CONFIG_BY_IDX)
+#else
+    CAN_BUS_CONFIG(DT_CHOSEN(zephyr_canbus))
+#endif
+};
+
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+// delays before the consecutive bus-off recovery attempts, the last one is repeated
+uint16_t const busOffRecoveryBackoffMs[] = {10U, 50U, 200U, 1000U};
+#endif
+
+static_assert(
+    (sizeof(canBusConfigs) / sizeof(canBusConfigs[0])) <= ::systems::CanSystem::MAX_CAN_BUSES,
+    "more CAN buses in devicetree than bus IDs");
+
+constexpr uint32_t STATISTICS_CYCLE_TIME = 1000;
+
+} // namespace
 
 namespace systems
 {
 
 ::systems::CanSystem::CanSystem(::async::ContextType context)
+: CanSystem(context, ::etl::span<BusConfig const>())
+{}
+
+::systems::CanSystem::CanSystem(
+    ::async::ContextType context, ::etl::span<BusConfig const> busConfigs)
 : ::lifecycle::SingleContextLifecycleComponent(context)
 , ::etl::singleton_base<CanSystem>(*this)
 , _context(context)
-, _transceiver0(
-      context,
-      busid::CAN_0,
-      CAN_INTERFACE,
-      CAN_BITRATE
-)
-{}
+, _timeout()
+, _transceivers()
+, _canStatisticsCommand()
+, _asyncCommandWrapper_for_canStatisticsCommand(_canStatisticsCommand, context)
+#ifdef PLATFORM_SUPPORT_CAN_BENCHMARK
+, _canBenchmarkCommand(context)
+, _asyncCommandWrapper_for_canBenchmarkCommand(_canBenchmarkCommand, context)
+#endif
+{
+    for (size_t i = 0U; i < (sizeof(canBusConfigs) / sizeof(canBusConfigs[0])); ++i)
+    {
+        CanBusConfig const& config = canBusConfigs[i];
+        _transceivers.emplace_back(
+            (i < busConfigs.size()) ? busConfigs[i]._context : context,
+            static_cast<uint8_t>(::busid::CAN_0 + i),
+            config._device,
+            config._bitrate,
+            CAN_FRAME_FORMAT,
+            config._dataBitrate);
+        (void)_canStatisticsCommand.addTransceiver(_transceivers.back());
+    }
+    // routes may point to any bus, so they are added when all transceivers exist
+    for (size_t i = 0U; i < ::etl::min(busConfigs.size(), _transceivers.size()); ++i)
+    {
+        BusConfig const& config = busConfigs[i];
+        ::bios::ExtendedIdFilter extendedIdFilter;
+        for (uint32_t const pgn : config._acceptedPgns)
+        {
+            (void)extendedIdFilter.addPgn(pgn);
+        }
+        for (ExtendedIdRange const& range : config._acceptedExtendedIds)
+        {
+            (void)extendedIdFilter.addRange(range._firstId, range._lastId);
+        }
+        _transceivers[i].setExtendedIdFilter(extendedIdFilter);
+
+        if (config._router != nullptr)
+        {
+            for (Route const& route : config._routes)
+            {
+                ::bios::ZephyrCanTransceiver* const destination
+                    = getZephyrCanTransceiver(route._destination);
+                if (destination != nullptr)
+                {
+                    (void)config._router->addRoute(
+                        route._firstId,
+                        route._lastId,
+                        route._extended,
+                        *destination,
+                        route._rewriteId,
+                        route._rewriteMask);
+                }
+            }
+            _transceivers[i].setRouter(config._router);
+        }
+    }
+#ifdef PLATFORM_SUPPORT_CAN_BENCHMARK
+    if (!_transceivers.empty())
+    {
+        _canBenchmarkCommand.setTransceiver(_transceivers[0]);
+    }
+#endif
+}
 
 void CanSystem::init() { transitionDone(); }
 
 void CanSystem::run()
 {
-    (void)_transceiver0.init();
-    (void)_transceiver0.open();
+    for (auto& transceiver : _transceivers)
+    {
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+        transceiver.setBusOffRecovery(
+            ::bios::ZephyrCanTransceiver::BusOffRecovery::MANUAL, busOffRecoveryBackoffMs);
+#endif
+        (void)transceiver.init();
+        (void)transceiver.open();
+    }
+
+    ::async::scheduleAtFixedRate(
+        _context, *this, _timeout, STATISTICS_CYCLE_TIME, ::async::TimeUnit::MILLISECONDS);
 
     transitionDone();
 }
 
 void CanSystem::shutdown()
 {
-    (void)_transceiver0.close();
-    _transceiver0.shutdown();
+    _timeout.cancel();
+
+    for (auto& transceiver : _transceivers)
+    {
+        (void)transceiver.close();
+        transceiver.shutdown();
+    }
 
     transitionDone();
 }
 
+void CanSystem::execute() { _canStatisticsCommand.cyclic_1000ms(); }
+
 ::can::ICanTransceiver* CanSystem::getCanTransceiver(uint8_t busId)
 {
-    if (busId == ::busid::CAN_0)
+    return getZephyrCanTransceiver(busId);
+}
+
+::bios::ZephyrCanTransceiver* CanSystem::getZephyrCanTransceiver(uint8_t busId)
+{
+    if ((busId >= ::busid::CAN_0)
+        && (static_cast<size_t>(busId - ::busid::CAN_0) < _transceivers.size()))
     {
-        return &_transceiver0;
+        return &_transceivers[busId - ::busid::CAN_0];
     }
     return nullptr;
 }
@@ -0,0 +1,102 @@
+// Copyright 2025 Accenture.
+
+#include "systems/CaptureSystem.h"
+
+#include <capture/Capture.h>
+
+#include <zephyr/device.h>
+#if !defined(CONFIG_ARCH_POSIX) && defined(PLATFORM_SUPPORT_ETHERNET)
+#include <zephyr/net/socket.h>
+#endif
+
+namespace
+{
+constexpr uint32_t SYSTEM_CYCLE_TIME = 10;
+
+// "capture arm" exports the frames around the first received CAN frame with ID 0x123
+constexpr uint32_t TRIGGER_CAN_ID = 0x123U;
+constexpr uint16_t PRE_TRIGGER    = 16U;
+constexpr uint16_t POST_TRIGGER   = 48U;
+
+#if defined(CONFIG_ARCH_POSIX)
+char const* const CAPTURE_FILE = "capture.pcapng";
+#elif defined(PLATFORM_SUPPORT_ETHERNET)
+constexpr uint16_t CAPTURE_PORT = 5555U;
+#else
+#if !DT_HAS_CHOSEN(openbsw_capture_uart)
+#error "bus capture requires the UART chosen as openbsw,capture-uart"
+#endif
+#endif
+} // namespace
+
+namespace systems
+{
+
+CaptureSystem::CaptureSystem(::async::ContextType const context)
+: _context(context)
+, _timeout()
+#if defined(CONFIG_ARCH_POSIX)
+, _sink(CAPTURE_FILE)
+#elif defined(PLATFORM_SUPPORT_ETHERNET)
+, _socket()
+, _sink(_socket)
+#else
+, _sink(DEVICE_DT_GET(DT_CHOSEN(openbsw_capture_uart)))
+#endif
+, _writer()
+, _exporter(::capture::getCaptureRing(), _writer, _sink)
+, _captureCommand(
+      _exporter,
+      ::capture::CaptureCondition::canId(
+          ::capture::CaptureCondition::typeBit(::capture::RecordType::CAN_RX),
+          TRIGGER_CAN_ID,
+          0x1FFFFFFFU),
+      PRE_TRIGGER,
+      POST_TRIGGER)
+, _asyncCommandWrapper_for_captureCommand(_captureCommand, context)
+{
+    setTransitionContext(context);
+}
+
+void CaptureSystem::init()
+{
+#if defined(CONFIG_ARCH_POSIX)
+    (void)_sink.open();
+#elif defined(PLATFORM_SUPPORT_ETHERNET)
+    // the capture stream must not capture itself
+    _socket.setCaptured(false);
+    struct in_addr peer;
+    (void)zsock_inet_pton(AF_INET, CONFIG_NET_CONFIG_PEER_IPV4_ADDR, &peer);
+    ::ip::IPAddress const any  = ::ip::make_ip4(0U, 0U, 0U, 0U);
+    ::ip::IPAddress const host = ::ip::make_ip4(
+        peer.s4_addr[0], peer.s4_addr[1], peer.s4_addr[2], peer.s4_addr[3]);
+    (void)_socket.bind(&any, 0U);
+    (void)_socket.connect(host, CAPTURE_PORT, nullptr);
+#endif
+    transitionDone();
+}
+
+void CaptureSystem::run()
+{
+    ::async::scheduleAtFixedRate(
+        _context, *this, _timeout, SYSTEM_CYCLE_TIME, ::async::TimeUnit::MILLISECONDS);
+
+    transitionDone();
+}
+
+void CaptureSystem::shutdown()
+{
+    _timeout.cancel();
+    _exporter.stop();
+#if defined(CONFIG_ARCH_POSIX)
+    _sink.close();
+#elif defined(PLATFORM_SUPPORT_ETHERNET)
+    _socket.close();
+#endif
+
+    transitionDone();
+}
+
+void CaptureSystem::execute() { _exporter.cyclic(); }
+
+} // namespace systems
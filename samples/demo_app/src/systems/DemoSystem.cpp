@@ -6,10 +6,19 @@
 
 #include <bsp/SystemTime.h>
 
-#include <etl/unaligned_type.h>
+#include <cstdio>
+#include <cstring>
+
 #ifdef PLATFORM_SUPPORT_CAN
+#include <can/CanLogger.h>
+#include <can/canframes/CanId.h>
 #include <can/transceiver/AbstractCANTransceiver.h>
 #endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+#include <udp/DatagramPacket.h>
+
+#include <zephyr/net/ethernet.h>
+#endif
 #include <zephyr/drivers/pwm.h>
 #include <zephyr/drivers/adc.h>
 
@@ -39,7 +48,45 @@ static struct adc_channel_cfg potChannCfg = {
 namespace
 {
 constexpr uint32_t SYSTEM_CYCLE_TIME = 10;
-}
+
+#ifdef PLATFORM_SUPPORT_CAN
+constexpr uint16_t CAN_TX_TICK_MS = 10U;
+
+using ::demo::signals::DemoCounter;
+using ::demo::signals::DemoStatus1;
+using ::demo::signals::DemoStatus2;
+using ::demo::signals::DemoStatus3;
+
+// cyclic messages on CAN_0, see demo.dbc for their signals
+::bios::CanTxMessage const canTxMessages[] = {
+    {DemoCounter::ID, 1000U, ::bios::CanTxScheduler::AUTO_OFFSET, DemoCounter::LENGTH},
+    {DemoStatus1::ID, 100U, ::bios::CanTxScheduler::AUTO_OFFSET, DemoStatus1::LENGTH},
+    {DemoStatus2::ID, 100U, ::bios::CanTxScheduler::AUTO_OFFSET, DemoStatus2::LENGTH},
+    {DemoStatus3::ID, 500U, ::bios::CanTxScheduler::AUTO_OFFSET, DemoStatus3::LENGTH},
+};
+
+// cyclic frames expected on CAN_0, see "CAN RX deadline monitor" in README.md
+::bios::CanRxDeadline const rxDeadlines[] = {
+    {::can::CanId::id(0x100U, false), 200U},
+    {::can::CanId::id(0x101U, false), 200U},
+    {::can::CanId::id(0x18FEF100U, true), 1000U},
+};
+
+constexpr uint16_t RX_DEADLINE_SWEEP_MS = 10U;
+
+// flow control answers to ISO-TP first frames, see fastpath_latency_test.py
+constexpr uint32_t FAST_PATH_REQUEST_ID  = 0x6F0U;
+constexpr uint32_t FAST_PATH_RESPONSE_ID = 0x6F8U;
+constexpr uint32_t TASK_REQUEST_ID       = 0x6F1U;
+constexpr uint32_t TASK_RESPONSE_ID      = 0x6F9U;
+constexpr uint32_t FAST_PATH_BUDGET_US   = 20U;
+constexpr uint8_t ISOTP_FIRST_FRAME      = 0x10U;
+constexpr uint8_t ISOTP_FRAME_TYPE_MASK  = 0xF0U;
+// continue to send, no block size limit, no separation time, padded to 8 bytes
+constexpr uint8_t FLOW_CONTROL_PAYLOAD[]
+    = {0x30U, 0x00U, 0x00U, 0xCCU, 0xCCU, 0xCCU, 0xCCU, 0xCCU};
+#endif
+} // namespace
 
 namespace systems
 {
@@ -47,8 +94,46 @@ using ::util::logger::DEMO;
 using ::util::logger::Logger;
 
 #ifdef PLATFORM_SUPPORT_ETHERNET
-static constexpr uint16_t ECHO_RX_PORT = 4444U;
+static constexpr uint16_t ECHO_RX_PORT        = 4444U;
+static constexpr uint16_t FRAMED_ECHO_TCP_PORT = 1235U;
+static constexpr uint16_t BULK_SOURCE_TCP_PORT = 1236U;
+// TX scheduler rate in percent of the link rate, so the TX queue of the interface stays short
+static constexpr uint32_t TX_SCHEDULER_LINK_PERCENT = 90U;
+// link rate assumed if the interface doesn't report one
+static constexpr uint32_t DEFAULT_LINK_MBIT_PER_S = 10U;
 static ::ip::IPAddress IP_ADDRESS(::ip::make_ip4(0U, 0U, 0U, 0U));
+// administratively scoped group joined by the echo server, a counter is announced every second
+static ::ip::IPAddress MULTICAST_GROUP(::ip::make_ip4(239U, 1U, 2U, 3U));
+static constexpr uint16_t ANNOUNCE_PORT   = 5000U;
+static constexpr uint32_t ANNOUNCE_CYCLES = 1000U / SYSTEM_CYCLE_TIME;
+#endif
+
+#ifdef PLATFORM_SUPPORT_ETHERNET
+/**
+ * \return rate of the TX scheduler shared by the TCP servers, derived from the fastest link
+ *         mode of the default interface
+ */
+static size_t getTxSchedulerBytesPerMs()
+{
+    uint32_t mbitPerS = DEFAULT_LINK_MBIT_PER_S;
+#ifdef CONFIG_NET_L2_ETHERNET
+    struct net_if* const iface = net_if_get_default();
+    if ((iface != nullptr) && (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)))
+    {
+        enum ethernet_hw_caps const caps = net_eth_get_hw_capabilities(iface);
+        if ((caps & ETHERNET_LINK_1000BASE_T) != 0U)
+        {
+            mbitPerS = 1000U;
+        }
+        else if ((caps & ETHERNET_LINK_100BASE_T) != 0U)
+        {
+            mbitPerS = 100U;
+        }
+    }
+#endif
+    // 1 Mbit/s is 125 bytes per ms
+    return static_cast<size_t>((mbitPerS * 125U * TX_SCHEDULER_LINK_PERCENT) / 100U);
+}
 #endif
 
 DemoSystem::DemoSystem(
@@ -56,28 +141,80 @@ DemoSystem::DemoSystem(
     ::lifecycle::ILifecycleManager& lifecycleManager
 #ifdef PLATFORM_SUPPORT_CAN
     ,
-    ::can::ICanSystem& canSystem
+    ::systems::CanSystem& canSystem
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    ,
+    ::etl::span<::async::ContextType const> const tcpConnectionContexts
 #endif
     )
 : _context(context)
 #ifdef PLATFORM_SUPPORT_CAN
 , _canSystem(canSystem)
+, _vehicleSpeedReceiver()
+, _canTxScheduler(canTxMessages, *this, CAN_TX_TICK_MS)
+, _flowControlFastPathResponder()
+, _flowControlResponders()
+, _rxDeadlineMonitor(rxDeadlines, RX_DEADLINE_SWEEP_MS)
+, _rxDeadlineLogger()
 #endif
 #ifdef PLATFORM_SUPPORT_ETHERNET
 , udpEchoServer(IP_ADDRESS, ECHO_RX_PORT, context)
 , _tcpSocket()
+, _tcpSendBuffer()
 , _tcpLoopback(_tcpSocket)
 , _zephyrServerSocketIpv4(1234, _tcpLoopback)
+, _txScheduler(context, getTxSchedulerBytesPerMs())
+, _framedEchoPool(tcpConnectionContexts)
+, _framedServerSocket(FRAMED_ECHO_TCP_PORT, _framedEchoPool)
+, _bulkSourcePool(tcpConnectionContexts)
+, _bulkServerSocket(BULK_SOURCE_TCP_PORT, _bulkSourcePool)
+, _udpCommand(udpEchoServer, _txScheduler)
+, _asyncCommandWrapper_for_udpCommand(_udpCommand, context)
+, _announceSocket()
+, _announceCycles(0U)
+, _announceCount(0U)
 #endif
 {
     setTransitionContext(context);
+#ifdef PLATFORM_SUPPORT_CAN
+    ::bios::ZephyrCanTransceiver* const canTransceiver
+        = _canSystem.getZephyrCanTransceiver(::busid::CAN_0);
+    if (canTransceiver != nullptr)
+    {
+        // handlers can't be removed again, so it is registered once
+        (void)canTransceiver->addFastPathHandler(
+            FAST_PATH_REQUEST_ID, false, _flowControlFastPathResponder, FAST_PATH_BUDGET_US);
+    }
+    (void)_rxDeadlineMonitor.addListener(_rxDeadlineLogger);
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    _tcpSocket.setContext(context);
+    _tcpSocket.setSendBuffer(_tcpSendBuffer);
+    _framedServerSocket.setBacklog(static_cast<int>(FRAMED_ECHO_CONNECTIONS));
+    _bulkServerSocket.setBacklog(static_cast<int>(BULK_SOURCE_CONNECTIONS));
+    // the echoes stand for diagnostic responses, which must not wait behind a bulk transfer
+    _framedEchoPool.setPriority(NET_PRIORITY_CA);
+    _bulkSourcePool.setPriority(NET_PRIORITY_BK);
+    (void)_framedEchoPool.setTxScheduler(_txScheduler);
+    (void)_bulkSourcePool.setTxScheduler(_txScheduler);
+#endif
 }
 
 void DemoSystem::init()
 {
 #ifdef PLATFORM_SUPPORT_ETHERNET
+    udpEchoServer.setMulticastGroup(MULTICAST_GROUP);
     udpEchoServer.start();
     _zephyrServerSocketIpv4.accept();
+    _framedServerSocket.accept();
+    _bulkServerSocket.accept();
+    // one datagram reaches all members of the group, TTL 1 keeps it on the link
+    if (_announceSocket.bind(&IP_ADDRESS, 0U)
+        == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
+    {
+        (void)_announceSocket.setMulticastTtl(1U);
+    }
 #endif
 #if defined(CONFIG_BOARD_S32K148EVB) && defined(CONFIG_ADC)
     int err;
@@ -137,15 +274,37 @@ void DemoSystem::run()
     ::async::scheduleAtFixedRate(
         _context, *this, _timeout, SYSTEM_CYCLE_TIME, ::async::TimeUnit::MILLISECONDS);
 #ifdef PLATFORM_SUPPORT_CAN
-    _canSystem.getCanTransceiver(::busid::CAN_0)->addCANFrameListener(_canReceiver);
+    ::bios::ZephyrCanTransceiver* const canTransceiver
+        = _canSystem.getZephyrCanTransceiver(::busid::CAN_0);
+    if (canTransceiver != nullptr)
+    {
+        canTransceiver->addCANFrameListener(_canReceiver);
+        canTransceiver->addCANFrameListener(_vehicleSpeedReceiver);
+        _canTxScheduler.start(_context, *canTransceiver);
+        _canSystem.setTxScheduler(_canTxScheduler);
+        _rxDeadlineMonitor.start(_context, *canTransceiver);
+        _canSystem.setRxDeadlineMonitor(_rxDeadlineMonitor);
+    }
+    for (size_t i = 0U; i < _canSystem.getCanBusCount(); ++i)
+    {
+        ::bios::ZephyrCanTransceiver& transceiver
+            = *_canSystem.getZephyrCanTransceiver(static_cast<uint8_t>(::busid::CAN_0 + i));
+        _flowControlResponders[i].setTransceiver(transceiver);
+        transceiver.addCANFrameListener(_flowControlResponders[i]);
+    }
 #endif
     transitionDone();
 }
 
 void DemoSystem::shutdown()
 {
+#ifdef PLATFORM_SUPPORT_CAN
+    _canTxScheduler.stop();
+    _rxDeadlineMonitor.stop();
+#endif
 #ifdef PLATFORM_SUPPORT_ETHERNET
     udpEchoServer.stop();
+    _announceSocket.close();
 #endif
     transitionDone();
 }
@@ -170,34 +329,124 @@ void DemoSystem::cyclic()
     pwm_set_dt(&pwm_led0, 1000000, timeCounter*5000);
 #endif
 #endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    if (++_announceCycles >= ANNOUNCE_CYCLES)
+    {
+        _announceCycles = 0U;
+        announce();
+    }
+#endif
+}
+
+#ifdef PLATFORM_SUPPORT_ETHERNET
+void DemoSystem::announce()
+{
+    if (!_announceSocket.isBound())
+    {
+        return;
+    }
+    char text[24];
+    int const length = snprintf(text, sizeof(text), "announce %u", _announceCount);
+    ++_announceCount;
+    (void)_announceSocket.send(::udp::DatagramPacket(
+        reinterpret_cast<uint8_t const*>(text),
+        static_cast<uint16_t>(length),
+        MULTICAST_GROUP,
+        ANNOUNCE_PORT));
+}
+#endif
 
 #ifdef PLATFORM_SUPPORT_CAN
-    static uint32_t previousSentTime = getSystemTimeMs32Bit();
-    static uint32_t canSentCount     = 0;
-    uint32_t const now               = getSystemTimeMs32Bit();
-    uint32_t const deltaTimeMs       = now - previousSentTime;
-    // Send a CAN frame every second.
-    if (deltaTimeMs >= 1000)
+void DemoSystem::fillPayload(size_t const index, ::can::CANFrame& frame)
+{
+    ::bios::CanTxScheduler::MessageState const& state = _canTxScheduler.getState(index);
+    uint32_t const frameCount                         = state._sent + state._failed;
+    uint8_t* const payload                            = frame.getPayload();
+    memset(payload, 0, frame.getPayloadLength());
+    switch (index)
     {
-        previousSentTime = now;
-        ::can::ICanTransceiver* canTransceiver
-            = _canSystem.getCanTransceiver(::busid::CAN_0);
-        if (canTransceiver != nullptr)
+        case 0U:
         {
-            Logger::debug(DEMO, "Sending frame %d", canSentCount);
-            etl::be_uint32_t canData{canSentCount};
-            ::can::CANFrame frame(0x558, static_cast<uint8_t*>(canData.data()), 4);
-            canTransceiver->write(frame);
-            ++canSentCount;
+            Logger::debug(DEMO, "Sending frame %d", frameCount);
+            DemoCounter::set<DemoCounter::Counter>(payload, frameCount);
+            break;
+        }
+        case 1U:
+        {
+            DemoStatus1::set<DemoStatus1::AliveCounter>(payload, frameCount);
+            break;
+        }
+        case 2U:
+        {
+            DemoStatus2::set<DemoStatus2::AliveCounter>(payload, frameCount);
+            break;
+        }
+        default:
+        {
+            DemoStatus3::set<DemoStatus3::AliveCounter>(payload, frameCount);
+            break;
         }
     }
-#endif
 }
-#ifdef PLATFORM_SUPPORT_CAN
+
+void DemoSystem::VehicleSpeedReceiver::messageReceived(uint8_t const payload[])
+{
+    using ::demo::signals::CCVS1;
+    float const speed = CCVS1::get<CCVS1::WheelBasedVehicleSpeed>(payload);
+    Logger::debug(
+        DEMO,
+        "Vehicle speed %d km/h, brake switch %d",
+        static_cast<int32_t>(speed),
+        CCVS1::get<CCVS1::BrakeSwitch>(payload));
+}
+
 void DemoSystem::CanReceiver::frameReceived(::can::CANFrame const& canFrame)
 {
     Logger::info(DEMO, "Frame received: 0x%x", canFrame.getId());
 }
+
+bool DemoSystem::FlowControlFastPathResponder::frameReceivedInIsr(
+    struct can_frame const& frame, ::bios::ZephyrCanTransceiver& transceiver)
+{
+    if ((frame.dlc == 0U) || ((frame.data[0] & ISOTP_FRAME_TYPE_MASK) != ISOTP_FIRST_FRAME))
+    {
+        return false;
+    }
+    struct can_frame response = {};
+    response.id               = FAST_PATH_RESPONSE_ID;
+    response.dlc              = sizeof(FLOW_CONTROL_PAYLOAD);
+    memcpy(response.data, FLOW_CONTROL_PAYLOAD, sizeof(FLOW_CONTROL_PAYLOAD));
+    (void)transceiver.forward(response);
+    return true;
+}
+
+DemoSystem::FlowControlResponder::FlowControlResponder()
+: _filter(TASK_REQUEST_ID, TASK_REQUEST_ID), _transceiver(nullptr)
+{}
+
+void DemoSystem::FlowControlResponder::frameReceived(::can::CANFrame const& frame)
+{
+    if ((_transceiver == nullptr) || (frame.getPayloadLength() == 0U)
+        || ((frame.getPayload()[0] & ISOTP_FRAME_TYPE_MASK) != ISOTP_FIRST_FRAME))
+    {
+        return;
+    }
+    ::can::CANFrame response;
+    response.setId(TASK_RESPONSE_ID);
+    response.setPayloadLength(sizeof(FLOW_CONTROL_PAYLOAD));
+    memcpy(response.getPayload(), FLOW_CONTROL_PAYLOAD, sizeof(FLOW_CONTROL_PAYLOAD));
+    (void)_transceiver->write(response);
+}
+
+void DemoSystem::RxDeadlineLogger::rxDeadlineMissed(size_t /* index */, uint32_t const id)
+{
+    Logger::warn(::util::logger::CAN, "RX timeout of frame 0x%x", ::can::CanId::rawId(id));
+}
+
+void DemoSystem::RxDeadlineLogger::rxDeadlineRecovered(size_t /* index */, uint32_t const id)
+{
+    Logger::info(::util::logger::CAN, "frame 0x%x received again", ::can::CanId::rawId(id));
+}
 #endif
 
 } // namespace systems
@@ -26,6 +26,12 @@ static uint8_t const FLOW_CONTROL_WAIT_COUNT = 15U;
 static uint16_t const MIN_SEPARATION_TIME    = 2U;
 static uint8_t const BLOCK_SIZE              = 15U;
 
+#ifdef CONFIG_CAN_FD_MODE
+static uint8_t const CODEC_INDEX = 1U; // FD codec
+#else
+static uint8_t const CODEC_INDEX = 0U; // classic codec
+#endif
+
 uint32_t systemUs() { return getSystemTimeUs32Bit(); }
 
 } // namespace
@@ -34,7 +40,7 @@ namespace docan
 {
 
 DoCanSystem::AddressingFilterType::AddressEntryType DoCanSystem::_addresses[]
-    = {{0x02A, 0x0F0U, 0x0F0U, LOGICAL_ADDRESS, 0, 0}};
+    = {{0x02A, 0x0F0U, 0x0F0U, LOGICAL_ADDRESS, CODEC_INDEX, CODEC_INDEX}};
 
 DoCanSystem::DoCanSystem(
     ::transport::ITransportSystem& transportSystem,
@@ -47,6 +53,7 @@ DoCanSystem::DoCanSystem(
 , _addressing()
 , _frameSizeMapper()
 , _classicCodec(::docan::DoCanFrameCodecConfigPresets::PADDED_CLASSIC, _frameSizeMapper)
+, _fdCodec(::docan::DoCanFrameCodecConfigPresets::PADDED_FD, _frameSizeMapper)
 , _classicAddressingFilter()
 , _parameters(
       ::etl::delegate<decltype(systemUs)>::create<&systemUs>(),
@@ -62,7 +69,7 @@ DoCanSystem::DoCanSystem(
 , _physicalTransceivers()
 , _transportLayers()
 , _tickGenerator(asyncContext, _transportLayers)
-, _codecs{&_classicCodec}
+, _codecs{&_classicCodec, &_fdCodec}
 {
     setTransitionContext(asyncContext);
 }
@@ -0,0 +1,122 @@
+// Copyright 2025 Accenture.
+
+#include "systems/XcpSystem.h"
+
+#ifdef PLATFORM_SUPPORT_CAN
+#include <busid/BusId.h>
+#include <can/canframes/CanId.h>
+#endif
+
+namespace
+{
+constexpr uint32_t SYSTEM_CYCLE_TIME = 1U;
+
+constexpr size_t EVENT_1MS  = 0U;
+constexpr size_t EVENT_10MS = 1U;
+
+#ifdef PLATFORM_SUPPORT_CAN
+constexpr uint32_t XCP_CRO_ID = ::can::CanId::id(0x550U, false);
+constexpr uint32_t XCP_DTO_ID = ::can::CanId::id(0x551U, false);
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+constexpr uint16_t XCP_PORT = 5555U;
+#endif
+} // namespace
+
+namespace systems
+{
+size_t const XcpSystem::EVENT_COUNT;
+size_t const XcpSystem::SIGNAL_COUNT;
+
+::xcp::XcpEventChannel const XcpSystem::EVENTS[EVENT_COUNT] = {{"1ms", 1U}, {"10ms", 10U}};
+
+XcpSystem::XcpSystem(
+    ::async::ContextType const context
+#ifdef PLATFORM_SUPPORT_CAN
+    ,
+    ::systems::CanSystem& canSystem
+#endif
+    )
+: _context(context)
+, _timeout()
+, _tick(0U)
+, _slope(1)
+, _measurement()
+, _calibration{1U, 1000}
+, _regions{
+      {reinterpret_cast<uint8_t*>(&_measurement), sizeof(_measurement), false},
+      {reinterpret_cast<uint8_t*>(&_calibration), sizeof(_calibration), true}}
+, _slave(context, _regions, EVENTS)
+#ifdef PLATFORM_SUPPORT_CAN
+, _canSystem(canSystem)
+, _canTransport(_slave, XCP_CRO_ID, XCP_DTO_ID)
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+, _socket()
+, _udpTransport(_slave, _socket)
+#endif
+, _xcpCommand(_slave)
+, _asyncCommandWrapper_for_xcpCommand(_xcpCommand, context)
+{
+    setTransitionContext(context);
+}
+
+void XcpSystem::init() { transitionDone(); }
+
+void XcpSystem::run()
+{
+#ifdef PLATFORM_SUPPORT_CAN
+    ::bios::ZephyrCanTransceiver* const canTransceiver
+        = _canSystem.getZephyrCanTransceiver(::busid::CAN_0);
+    if (canTransceiver != nullptr)
+    {
+        _canTransport.start(*canTransceiver);
+    }
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    (void)_udpTransport.start(XCP_PORT);
+#endif
+    _slave.resetStatistics();
+    ::async::scheduleAtFixedRate(
+        _context, *this, _timeout, SYSTEM_CYCLE_TIME, ::async::TimeUnit::MILLISECONDS);
+
+    transitionDone();
+}
+
+void XcpSystem::shutdown()
+{
+    _timeout.cancel();
+    _slave.disconnect();
+#ifdef PLATFORM_SUPPORT_CAN
+    _canTransport.stop();
+#endif
+#ifdef PLATFORM_SUPPORT_ETHERNET
+    _udpTransport.stop();
+#endif
+
+    transitionDone();
+}
+
+void XcpSystem::execute()
+{
+    ++_tick;
+    _measurement._counter += _calibration._increment;
+    if ((_measurement._triangle >= _calibration._amplitude)
+        || (_measurement._triangle <= -_calibration._amplitude))
+    {
+        _slope = (_measurement._triangle > 0) ? -1 : 1;
+    }
+    _measurement._triangle = static_cast<int16_t>(_measurement._triangle + _slope);
+    for (size_t i = 0U; i < SIGNAL_COUNT; ++i)
+    {
+        _measurement._signals[i] = _measurement._counter * static_cast<uint32_t>(i + 1U);
+    }
+
+    _slave.event(EVENT_1MS);
+    if ((_tick % 10U) == 0U)
+    {
+        _slave.event(EVENT_10MS);
+    }
+}
+
+} // namespace systems
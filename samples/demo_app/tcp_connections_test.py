@@ -0,0 +1,79 @@
+# Copyright 2025 Accenture.
+
+# Load test of the framed TCP echo server of demo_app on native_sim with several concurrent
+# connections: each client keeps a window of frames in flight, checks every echo and the
+# aggregate and per-connection throughput is reported. The server has 16 connections on
+# native_sim, spread over the tasks demo and eth.
+#
+# usage: python3 tcp_connections_test.py [clients] [seconds] [length] [window]
+
+import socket
+import struct
+import sys
+import threading
+import time
+
+TARGET = '192.0.2.1', 1235
+RECV_BUF_SIZE = 65535
+
+
+class Client(threading.Thread):
+    def __init__(self, index, seconds, length, window):
+        super().__init__()
+        self.index = index
+        self.seconds = seconds
+        self.window = window
+        self.frame = struct.pack('>H', length) + bytes((index + i) & 0xFF for i in range(length))
+        self.frames = 0
+        self.errors = 0
+        self.duration = 0.0
+
+    def run(self):
+        s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        s.bind(('192.0.2.2', 0))
+        s.settimeout(2)
+        try:
+            s.connect(TARGET)
+        except OSError as e:
+            print(f'client {self.index}: connect failed: {e}')
+            self.errors += 1
+            return
+        received = b''
+        in_flight = 0
+        start = time.time()
+        try:
+            while time.time() - start < self.seconds:
+                while in_flight < self.window:
+                    s.sendall(self.frame)
+                    in_flight += 1
+                received += s.recv(RECV_BUF_SIZE)
+                while len(received) >= len(self.frame):
+                    if received[:len(self.frame)] != self.frame:
+                        self.errors += 1
+                    received = received[len(self.frame):]
+                    in_flight -= 1
+                    self.frames += 1
+        except (TimeoutError, OSError) as e:
+            print(f'client {self.index}: {e} after {self.frames} frames')
+            self.errors += 1
+        self.duration = time.time() - start
+        s.close()
+
+
+if __name__ == '__main__':
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 8
+    seconds = float(sys.argv[2]) if len(sys.argv) > 2 else 5.0
+    length = int(sys.argv[3]) if len(sys.argv) > 3 else 512
+    window = int(sys.argv[4]) if len(sys.argv) > 4 else 4
+    clients = [Client(i, seconds, length, window) for i in range(count)]
+    for client in clients:
+        client.start()
+    for client in clients:
+        client.join()
+    rates = [c.frames * len(c.frame) / c.duration / 1000 if c.duration > 0 else 0.0
+             for c in clients]
+    errors = sum(c.errors for c in clients)
+    print(f'{count} connections, frames of {length} bytes, window {window}: '
+          f'{sum(rates):.1f} kB/s echoed in total, per connection '
+          f'min {min(rates):.1f} kB/s, max {max(rates):.1f} kB/s, {errors} errors')
+    sys.exit(0 if (errors == 0) and (min(rates) > 0) else 1)
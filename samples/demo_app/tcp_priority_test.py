@@ -0,0 +1,112 @@
+# Copyright 2025 Accenture.
+
+# Latency of small frames on the framed TCP echo server of demo_app on native_sim while bulk
+# connections to the bulk source server (port 1236) load the TX path of the target. The echo
+# connections have priority NET_PRIORITY_CA, the bulk connections NET_PRIORITY_BK. The round
+# trip time of the frames is measured once without and once with the bulk load, the mode of
+# the TX scheduler is switched on the console of the target with "udp txsched" (fifo, strict,
+# weighted) and "udp txstat" shows the bytes granted per class.
+#
+# usage: python3 tcp_priority_test.py [frames] [length] [bulk connections]
+
+import socket
+import statistics
+import struct
+import sys
+import threading
+import time
+
+ECHO_TARGET = '192.0.2.1', 1235
+BULK_TARGET = '192.0.2.1', 1236
+RECV_BUF_SIZE = 65535
+
+
+class BulkClient(threading.Thread):
+    def __init__(self, index):
+        super().__init__()
+        self.index = index
+        self.received = 0
+        self.duration = 0.0
+        self.running = True
+        self.error = None
+
+    def run(self):
+        s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        s.bind(('192.0.2.2', 0))
+        s.settimeout(2)
+        start = time.time()
+        try:
+            s.connect(BULK_TARGET)
+            while self.running:
+                data = s.recv(RECV_BUF_SIZE)
+                if not data:
+                    break
+                self.received += len(data)
+        except (TimeoutError, OSError) as e:
+            self.error = e
+        self.duration = time.time() - start
+        s.close()
+
+
+def measure(frames, length):
+    s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    s.bind(('192.0.2.2', 0))
+    s.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    s.settimeout(2)
+    s.connect(ECHO_TARGET)
+    frame = struct.pack('>H', length) + bytes(i & 0xFF for i in range(length))
+    rtts = []
+    errors = 0
+    for _ in range(frames):
+        start = time.perf_counter()
+        s.sendall(frame)
+        received = b''
+        try:
+            while len(received) < len(frame):
+                received += s.recv(len(frame) - len(received))
+        except (TimeoutError, OSError):
+            errors += 1
+            break
+        rtts.append((time.perf_counter() - start) * 1000)
+        if received != frame:
+            errors += 1
+        time.sleep(0.002)
+    s.close()
+    return rtts, errors
+
+
+def report(name, rtts):
+    if not rtts:
+        print(f'{name}: no echoes')
+        return
+    rtts = sorted(rtts)
+    p99 = rtts[min(len(rtts) - 1, int(len(rtts) * 0.99))]
+    print(f'{name}: {len(rtts)} echoes, median {statistics.median(rtts):.3f} ms, '
+          f'p99 {p99:.3f} ms, max {rtts[-1]:.3f} ms')
+
+
+if __name__ == '__main__':
+    frames = int(sys.argv[1]) if len(sys.argv) > 1 else 500
+    length = int(sys.argv[2]) if len(sys.argv) > 2 else 32
+    count = int(sys.argv[3]) if len(sys.argv) > 3 else 2
+
+    idle, errors = measure(frames, length)
+    report('idle', idle)
+
+    bulk = [BulkClient(i) for i in range(count)]
+    for client in bulk:
+        client.start()
+    time.sleep(0.5)
+    loaded, loaded_errors = measure(frames, length)
+    errors += loaded_errors
+    for client in bulk:
+        client.running = False
+    for client in bulk:
+        client.join()
+    report(f'{count} bulk connections', loaded)
+    for client in bulk:
+        if client.error is not None:
+            print(f'bulk {client.index}: {client.error}')
+    rate = sum(c.received / c.duration / 1000 for c in bulk if c.duration > 0)
+    print(f'bulk load {rate:.1f} kB/s, {errors} echo errors')
+    sys.exit(0 if (errors == 0) and idle and loaded else 1)
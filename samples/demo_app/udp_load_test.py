@@ -0,0 +1,59 @@
+# Copyright 2025 Accenture.
+
+# Load generator for the UDP echo server of demo_app on native_sim: keeps a window of small
+# datagrams in flight and reports the echo rate and the loss. Compare "udp batch" off and on,
+# "udp echo" prints the batch and send statistics of the target.
+#
+# usage: python3 udp_load_test.py [length] [window] [seconds]
+
+import socket
+import struct
+import sys
+import time
+
+TARGET = '192.0.2.1', 4444
+RECV_BUF_SIZE = 65535
+# a window that is not answered within this time is considered lost
+TIMEOUT = 0.2
+
+
+def run(length, window, seconds):
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.bind(('192.0.2.2', 0))
+    s.settimeout(TIMEOUT)
+    padding = b'#' * (length - 4)
+    sent = 0
+    received = 0
+    in_flight = 0
+    start = time.time()
+    while time.time() - start < seconds:
+        while in_flight < window:
+            s.sendto(struct.pack('<I', sent) + padding, TARGET)
+            sent += 1
+            in_flight += 1
+        try:
+            s.recvfrom(RECV_BUF_SIZE)
+            received += 1
+            in_flight -= 1
+        except TimeoutError:
+            # the rest of the window is lost
+            in_flight = 0
+    duration = time.time() - start
+    # late echoes of the last window
+    try:
+        while True:
+            s.recvfrom(RECV_BUF_SIZE)
+            received += 1
+    except TimeoutError:
+        pass
+    print(f'{length} byte datagrams, window {window}: sent {sent}, received {received} in '
+          f'{duration:.1f} s: {received / duration:.0f} echoes/s, '
+          f'{100.0 * (sent - received) / max(sent, 1):.1f} % lost')
+    return received > 0
+
+
+if __name__ == '__main__':
+    length = int(sys.argv[1]) if len(sys.argv) > 1 else 16
+    window = int(sys.argv[2]) if len(sys.argv) > 2 else 16
+    seconds = float(sys.argv[3]) if len(sys.argv) > 3 else 5.0
+    sys.exit(0 if run(max(length, 4), window, seconds) else 1)
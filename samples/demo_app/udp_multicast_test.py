@@ -0,0 +1,75 @@
+# Copyright 2025 Accenture.
+
+# Multicast test for demo_app on native_sim. Several host sockets join the group the target
+# announces a counter to every second, each transmission of the target has to reach all of
+# them. Then a datagram is sent to the group on the echo port, the echo server has joined the
+# group and answers it by unicast.
+#
+# usage: python3 udp_multicast_test.py [receivers] [seconds]
+
+import socket
+import struct
+import sys
+import time
+
+HOST = '192.0.2.2'
+GROUP = '239.1.2.3'
+ANNOUNCE_PORT = 5000
+ECHO_PORT = 4444
+RECV_BUF_SIZE = 1500
+
+
+def receiver():
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    s.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+    s.bind((GROUP, ANNOUNCE_PORT))
+    s.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP,
+                 socket.inet_aton(GROUP) + socket.inet_aton(HOST))
+    s.setblocking(False)
+    return s
+
+
+def fan_out(count, seconds):
+    sockets = [receiver() for _ in range(count)]
+    announces = [set() for _ in range(count)]
+    start = time.time()
+    while time.time() - start < seconds:
+        for s, received in zip(sockets, announces):
+            try:
+                while True:
+                    data, _ = s.recvfrom(RECV_BUF_SIZE)
+                    received.add(data.decode())
+            except BlockingIOError:
+                pass
+        time.sleep(0.01)
+    for s in sockets:
+        s.close()
+    common = set.intersection(*announces)
+    print(f'{count} receivers got {[len(r) for r in announces]} announces, '
+          f'{len(common)} of them reached all receivers')
+    return (len(common) > 0) and all(r == announces[0] for r in announces)
+
+
+def echo():
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(HOST))
+    s.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, struct.pack('b', 1))
+    s.bind((HOST, 0))
+    s.settimeout(1)
+    s.sendto(b'hello group', (GROUP, ECHO_PORT))
+    try:
+        data, source = s.recvfrom(RECV_BUF_SIZE)
+    except TimeoutError:
+        print('no echo of the datagram sent to the group')
+        return False
+    print(f'echo of the datagram sent to the group from {source[0]}: {data}')
+    return data == b'hello group'
+
+
+if __name__ == '__main__':
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 4
+    seconds = float(sys.argv[2]) if len(sys.argv) > 2 else 5.0
+    ok = fan_out(count, seconds)
+    ok = echo() and ok
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,151 @@
+# Copyright 2025 Accenture.
+
+# Minimal XCP master measuring the DAQ throughput of demo_app built with -DOPENBSW_XCP=ON.
+# A DAQ list with the given number of 32 bit signals of XcpSystem::Measurement is sampled by
+# the 1 ms event, the received DTOs are counted and checked for consistency: all signals of one
+# sample must be multiples of the same counter. The CPU cost per signal is printed on the
+# demo_app console by "xcp stats".
+#
+# usage: python3 xcp_daq_test.py [udp|can] [signals] [seconds]
+
+import socket
+import struct
+import sys
+import time
+
+UDP_TARGET = '192.0.2.1', 5555
+CAN_INTERFACE = 'vcan0'
+CAN_FRAME_FORMAT = '=IB3x8s'
+CRO_ID = 0x550
+DTO_ID = 0x551
+
+SIGNALS_OFFSET = 8
+SIGNAL_SIZE = 4
+MEASUREMENT_EXTENSION = 0
+EVENT_1MS = 0
+
+
+class UdpTransport:
+    max_dto = 512
+    timestamp_size = 4
+
+    def __init__(self):
+        self.s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.s.bind(('192.0.2.2', 0))
+        self.s.settimeout(1)
+        self.counter = 0
+
+    def send(self, packet):
+        self.s.sendto(struct.pack('<HH', len(packet), self.counter) + packet, UDP_TARGET)
+        self.counter += 1
+
+    def receive(self):
+        data, _ = self.s.recvfrom(65535)
+        packets = []
+        offset = 0
+        while offset + 4 <= len(data):
+            length, _ = struct.unpack_from('<HH', data, offset)
+            packets.append(data[offset + 4:offset + 4 + length])
+            offset += 4 + length
+        return packets
+
+
+class CanTransport:
+    # a timestamp would leave no room for a signal in the first ODT
+    max_dto = 8
+    timestamp_size = 0
+
+    def __init__(self):
+        self.s = socket.socket(socket.AF_CAN, socket.SOCK_RAW, socket.CAN_RAW)
+        self.s.bind((CAN_INTERFACE,))
+        self.s.settimeout(1)
+
+    def send(self, packet):
+        self.s.send(struct.pack(CAN_FRAME_FORMAT, CRO_ID, len(packet), packet.ljust(8, b'\0')))
+
+    def receive(self):
+        while True:
+            can_id, length, data = struct.unpack(CAN_FRAME_FORMAT, self.s.recv(16))
+            if can_id == DTO_ID:
+                return [data[:length]]
+
+
+def command(transport, packet):
+    transport.send(bytes(packet))
+    while True:
+        for response in transport.receive():
+            if response[0] == 0xFF:
+                return response
+            if response[0] == 0xFE:
+                raise RuntimeError(f'command {packet[0]:02X} failed: error {response[1]:02X}')
+
+
+def configure(transport, signals):
+    # the first ODT carries the timestamp
+    per_odt = (transport.max_dto - 1 - transport.timestamp_size) // SIGNAL_SIZE
+    odts = [min(per_odt, signals - i) for i in range(0, signals, per_odt)]
+    command(transport, [0xD6])
+    command(transport, [0xD5, 0, 1, 0])
+    command(transport, [0xD4, 0, 0, 0, len(odts)])
+    for odt, count in enumerate(odts):
+        command(transport, [0xD3, 0, 0, 0, odt, count])
+    signal = 0
+    for odt, count in enumerate(odts):
+        command(transport, [0xE2, 0, 0, 0, odt, 0])
+        for _ in range(count):
+            address = SIGNALS_OFFSET + signal * SIGNAL_SIZE
+            command(transport, [0xE1, 0xFF, SIGNAL_SIZE, MEASUREMENT_EXTENSION]
+                    + list(struct.pack('<I', address)))
+            signal += 1
+    # 1 ms event, prescaler 1
+    mode = 0x10 if transport.timestamp_size > 0 else 0x00
+    command(transport, [0xE0, mode, 0, 0, EVENT_1MS, 0, 1, 0])
+    return odts
+
+
+def measure(transport, odts, seconds):
+    first_pid = command(transport, [0xDE, 1, 0, 0])[1]
+    dtos = 0
+    payload = 0
+    samples = 0
+    inconsistent = 0
+    values = []
+    start = time.time()
+    while time.time() - start < seconds:
+        try:
+            packets = transport.receive()
+        except TimeoutError:
+            break
+        for packet in packets:
+            pid = packet[0]
+            if pid < first_pid or pid >= first_pid + len(odts):
+                continue
+            dtos += 1
+            payload += len(packet)
+            data = packet[1 + transport.timestamp_size:] if pid == first_pid else packet[1:]
+            if pid == first_pid:
+                values = []
+            values += struct.unpack(f'<{len(data) // SIGNAL_SIZE}I', data)
+            if pid == first_pid + len(odts) - 1:
+                samples += 1
+                if any(v != (values[0] * (i + 1)) & 0xFFFFFFFF for i, v in enumerate(values)):
+                    inconsistent += 1
+    duration = time.time() - start
+    command(transport, [0xDE, 0, 0, 0])
+    signals = sum(odts)
+    print(f'{samples} samples of {signals} signals in {len(odts)} ODTs in {duration:.1f} s: '
+          f'{samples / duration:.0f} samples/s, {dtos / duration:.0f} DTOs/s, '
+          f'{payload / duration / 1000:.1f} kB/s, {inconsistent} inconsistent')
+    return (samples > 0) and (inconsistent == 0)
+
+
+if __name__ == '__main__':
+    kind = sys.argv[1] if len(sys.argv) > 1 else 'udp'
+    transport = CanTransport() if kind == 'can' else UdpTransport()
+    signals = int(sys.argv[2]) if len(sys.argv) > 2 else (64 if kind == 'udp' else 8)
+    seconds = float(sys.argv[3]) if len(sys.argv) > 3 else 5.0
+    response = command(transport, [0xFF, 0])
+    print(f'connected, MAX_CTO {response[3]}, MAX_DTO {struct.unpack_from("<H", response, 4)[0]}')
+    ok = measure(transport, configure(transport, signals), seconds)
+    command(transport, [0xFE])
+    sys.exit(0 if ok else 1)